@@ -0,0 +1,68 @@
+//
+// bench_accumulator.cpp
+//
+// Sum of 10M prices with four fraction digits by repeated operator+= next to
+// PrecisedFloat::Accumulator, for one magnitude order and for mixed ones.
+//
+
+#include "../precised_float.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+int main() {
+    constexpr auto VALUES_COUNT = 10'000'000;
+    constexpr auto REPETITIONS = 10;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> price_distribution{-99'999'999, 99'999'999};
+    std::uniform_int_distribution<int> divisor_distribution{0, 4};
+    const PrecisedFloat cents{std::string{"0.0001"}};
+
+    std::vector<PrecisedFloat> prices;
+    std::vector<PrecisedFloat> mixed_prices;
+    prices.reserve(VALUES_COUNT);
+    mixed_prices.reserve(VALUES_COUNT);
+    for (auto i = 0; i < VALUES_COUNT; ++i) {
+        prices.push_back(PrecisedFloat{price_distribution(generator)} * cents);
+
+        PrecisedFloat mixed_price{price_distribution(generator)};
+        for (auto divisions = divisor_distribution(generator); divisions > 0; --divisions) {
+            mixed_price /= 10;
+        }
+        mixed_prices.push_back(mixed_price);
+    }
+
+    const auto report = [](const char* name, const std::chrono::steady_clock::duration elapsed, const PrecisedFloat& sum) {
+        const auto milliseconds = std::chrono::duration<double, std::milli>(elapsed).count() / REPETITIONS;
+        std::printf("%-36s %8.2f ms  %6.2f ns/value  (sum: %s)\n", name, milliseconds, milliseconds * 1e6 / VALUES_COUNT, sum.str().c_str());
+    };
+
+    for (const auto* values : {&prices, &mixed_prices}) {
+        std::printf("%s\n", values == &prices ? "one magnitude order" : "mixed magnitude orders");
+
+        PrecisedFloat sum;
+        auto start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            sum = PrecisedFloat{0};
+            for (const auto& value : *values) {
+                sum += value;
+            }
+        }
+        report("  operator+=", std::chrono::steady_clock::now() - start, sum);
+
+        start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            PrecisedFloat::Accumulator accumulator;
+            accumulator.add(std::span<const PrecisedFloat>{*values});
+            sum = accumulator.result();
+        }
+        report("  PrecisedFloat::Accumulator", std::chrono::steady_clock::now() - start, sum);
+    }
+
+    return 0;
+}
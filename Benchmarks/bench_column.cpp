@@ -0,0 +1,94 @@
+//
+// bench_column.cpp
+//
+// Element-wise P&L over 10M rows: (price - cost) * quantity as a loop over
+// std::vector<PrecisedFloat> next to the same kernels on PrecisedFloatColumn
+// with every instruction set the processor has.
+//
+
+#include "../precised_float_column.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+int main() {
+    constexpr auto ROWS_COUNT = 10'000'000;
+    constexpr auto REPETITIONS = 10;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> price_distribution{1, 99'999'999};
+    std::uniform_int_distribution<long long> quantity_distribution{-10'000, 10'000};
+    const PrecisedFloat cents{std::string{"0.0001"}};
+
+    std::vector<PrecisedFloat> prices;
+    std::vector<PrecisedFloat> costs;
+    std::vector<PrecisedFloat> quantities;
+    for (auto i = 0; i < ROWS_COUNT; ++i) {
+        prices.push_back(PrecisedFloat{price_distribution(generator)} * cents);
+        costs.push_back(PrecisedFloat{price_distribution(generator)} * cents);
+        quantities.push_back(PrecisedFloat{quantity_distribution(generator)});
+    }
+
+    // <row_bytes> is the memory traffic of one row: every array read or written
+    const auto report = [](const char* name, const std::chrono::steady_clock::duration elapsed, const std::size_t row_bytes) {
+        const auto seconds = std::chrono::duration<double>(elapsed).count() / REPETITIONS;
+        std::printf("%-28s %8.2f ms  %6.2f GB/s\n", name, seconds * 1e3, static_cast<double>(row_bytes) * ROWS_COUNT / seconds / 1e9);
+    };
+
+    std::vector<PrecisedFloat> pnl(ROWS_COUNT);
+    auto start = std::chrono::steady_clock::now();
+    for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+        for (auto i = 0; i < ROWS_COUNT; ++i) {
+            pnl[i] = (prices[i] - costs[i]) * quantities[i];
+        }
+    }
+    report("std::vector<PrecisedFloat>", std::chrono::steady_clock::now() - start, 4 * sizeof(PrecisedFloat));
+
+    using Kernels = PrecisedFloatColumn::Kernels;
+    struct KernelsCase {
+        Kernels kernels;
+        const char* name;
+    };
+    const KernelsCase kernels_cases[]{{Kernels::SCALAR, "column, scalar"}, {Kernels::AVX2, "column, AVX2"}, {Kernels::AVX512, "column, AVX-512"}};
+
+    const PrecisedFloatColumn price_column{prices};
+    const PrecisedFloatColumn cost_column{costs};
+    const PrecisedFloatColumn quantity_column{quantities};
+    const PrecisedFloatColumn shared_price_column{prices, 4};
+    const PrecisedFloatColumn shared_cost_column{costs, 4};
+    const PrecisedFloatColumn shared_quantity_column{quantities, 0};
+    // sub() and mul() read two columns and write one each
+    constexpr auto COLUMN_ROW_BYTES = 6 * (sizeof(unsigned long long) + sizeof(unsigned short) + 1);
+    constexpr auto SHARED_COLUMN_ROW_BYTES = 6 * (sizeof(unsigned long long) + 1);
+
+    for (const auto& kernels_case : kernels_cases) {
+        if (kernels_case.kernels > PrecisedFloatColumn::best_kernels()) {
+            continue;
+        }
+
+        PrecisedFloatColumn pnl_column;
+        start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            sub(price_column, cost_column, pnl_column, kernels_case.kernels);
+            mul(pnl_column, quantity_column, pnl_column, kernels_case.kernels);
+        }
+        report(kernels_case.name, std::chrono::steady_clock::now() - start, COLUMN_ROW_BYTES);
+
+        start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            sub(shared_price_column, shared_cost_column, pnl_column, kernels_case.kernels);
+            mul(pnl_column, shared_quantity_column, pnl_column, kernels_case.kernels);
+        }
+        report("  shared scale", std::chrono::steady_clock::now() - start, SHARED_COLUMN_ROW_BYTES);
+
+        for (auto i = 0; i < ROWS_COUNT; i += ROWS_COUNT / 7) {
+            if (pnl_column[i] != pnl[i]) {
+                std::printf("  mismatch at %d: %s != %s\n", i, pnl_column[i].str().c_str(), pnl[i].str().c_str());
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+//
+// bench_column_file.cpp
+//
+// Range queries over 10M prices of a random walk: the text of all of them
+// parsed again by parse_batch() for every query next to scan() and count()
+// of a column file, whose zone maps skip the blocks out of the range.
+//
+
+#include "../precised_float_column_file.h"
+#include "../precised_float_formatting.h"
+#include "../precised_float_parsing.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+int main() {
+    constexpr auto VALUES_COUNT = 10'000'000;
+    constexpr auto QUERIES_COUNT = 20;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> step_distribution{-500, 500};
+    std::vector<PrecisedFloat> prices;
+    prices.reserve(VALUES_COUNT);
+    long long price = 10'000'000;
+    for (auto i = 0; i < VALUES_COUNT; ++i) {
+        price += step_distribution(generator);
+        prices.push_back(PrecisedFloat{price} * PrecisedFloat{std::string{"0.0001"}});
+    }
+
+    const auto text = format_batch(std::span<const PrecisedFloat>{prices});
+    const auto path = (std::filesystem::temp_directory_path() / "bench_column_file.pfc").string();
+    PrecisedFloatColumnFile::write(path.c_str(), std::span<const PrecisedFloat>{prices});
+    std::printf("text %zu bytes, column file %zu bytes\n", text.size(), static_cast<std::size_t>(std::filesystem::file_size(path)));
+
+    // Windows of 0.1% of the price around prices of the series
+    std::vector<std::pair<PrecisedFloat, PrecisedFloat>> ranges;
+    for (auto i = 0; i < QUERIES_COUNT; ++i) {
+        const auto& center = prices[generator() % prices.size()];
+        const auto half_width = center * PrecisedFloat{std::string{"0.0005"}};
+        ranges.emplace_back(center - half_width, center + half_width);
+    }
+
+    const auto measure = [](const char* name, const auto& query) {
+        std::size_t matches_count = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (auto i = 0; i < QUERIES_COUNT; ++i) {
+            matches_count += query(i);
+        }
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / QUERIES_COUNT;
+        std::printf("%-34s %8.3f ms/query  (%zu matches)\n", name, seconds * 1e3, matches_count);
+    };
+
+    std::vector<PrecisedFloat> parsed;
+    parsed.reserve(VALUES_COUNT);
+    measure("parse_batch() and filter", [&](const int i) {
+        parsed.clear();
+        parse_batch(text, parsed);
+        std::size_t matches_count = 0;
+        for (const auto& p_float : parsed) {
+            matches_count += ranges[i].first <= p_float && p_float <= ranges[i].second ? 1 : 0;
+        }
+        return matches_count;
+    });
+
+    const PrecisedFloatColumnFile file{path.c_str()};
+    measure("PrecisedFloatColumnFile::scan()", [&](const int i) {
+        PrecisedFloat sum{0};
+        const auto matches_count = file.scan(ranges[i].first, ranges[i].second, [&sum](std::size_t, const PrecisedFloat& p_float) {
+            sum += p_float;
+        });
+        return sum.is_nan() ? 0 : matches_count;
+    });
+    measure("PrecisedFloatColumnFile::count()", [&](const int i) {
+        return file.count(ranges[i].first, ranges[i].second);
+    });
+
+    std::filesystem::remove(path);
+    return 0;
+}
@@ -0,0 +1,85 @@
+//
+// bench_csv_reader.cpp
+//
+// Loading the price and quantity columns of a 2M-record CSV file: std::getline
+// with a std::string per field and the string constructor next to
+// read_csv_columns() on one thread and on every core.
+//
+
+#include "../precised_float_csv.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main() {
+    constexpr auto RECORDS_COUNT = 2'000'000;
+    constexpr auto REPETITIONS = 3;
+
+    const auto path = (std::filesystem::temp_directory_path() / "bench_csv_reader.csv").string();
+    {
+        std::mt19937_64 generator{42};
+        std::uniform_int_distribution<long long> price_distribution{1, 99'999'999};
+        std::uniform_int_distribution<long long> quantity_distribution{-10'000, 10'000};
+        std::ofstream file{path, std::ios::binary};
+        file << "id,price,symbol,quantity\n";
+        for (auto i = 0; i < RECORDS_COUNT; ++i) {
+            file << i << ',' << (PrecisedFloat{price_distribution(generator)} * PrecisedFloat{std::string{"0.0001"}}).str() << ",SYM" << i % 500 << ','
+                 << quantity_distribution(generator) << '\n';
+        }
+    }
+    const auto file_size = static_cast<double>(std::filesystem::file_size(path));
+
+    const auto measure = [file_size](const char* name, const auto& read) {
+        std::vector<std::vector<PrecisedFloat>> columns;
+        const auto start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            columns = read();
+        }
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / REPETITIONS;
+        std::printf("%-32s %8.2f ms  %6.2f GB/s  (%zu rows, %s)\n", name, seconds * 1e3, file_size / seconds / 1e9, columns[0].size(),
+                    columns[0].back().str().c_str());
+    };
+
+    measure("std::getline()", [&path] {
+        std::vector<std::vector<PrecisedFloat>> columns(2);
+        std::ifstream file{path};
+        std::string line;
+        std::getline(file, line);
+        while (std::getline(file, line)) {
+            std::stringstream record{line};
+            std::string field;
+            for (auto column = 0; std::getline(record, field, ','); ++column) {
+                if (column == 1) {
+                    columns[0].push_back(PrecisedFloat{field});
+                } else if (column == 3) {
+                    columns[1].push_back(PrecisedFloat{field});
+                }
+            }
+        }
+        return columns;
+    });
+
+    const std::vector<std::size_t> selected{1, 3};
+    std::vector<unsigned> threads_counts{1};
+    if (std::thread::hardware_concurrency() > 1) {
+        threads_counts.push_back(std::thread::hardware_concurrency());
+    }
+    for (const auto threads_count : threads_counts) {
+        const auto name = "read_csv_columns(), " + std::to_string(threads_count) + " thread(s)";
+        measure(name.c_str(), [&path, &selected, threads_count] {
+            std::vector<std::vector<PrecisedFloat>> columns;
+            read_csv_columns(path.c_str(), selected, columns, ',', true, threads_count);
+            return columns;
+        });
+    }
+
+    std::filesystem::remove(path);
+    return 0;
+}
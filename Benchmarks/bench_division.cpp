@@ -0,0 +1,56 @@
+//
+// bench_division.cpp
+//
+// Worst-case latency of PrecisedFloat::operator/= for operand pairs which
+// produce a big integer part and/or the full MAGNITUDE_ORDER_LIMIT fraction,
+// next to the same division by a prepared PrecisedFloat::Divisor.
+//
+
+#include "../precised_float.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+int main() {
+    struct BenchCase {
+        std::string dividend;
+        std::string divisor;
+    };
+    const std::vector<BenchCase> bench_cases{
+        {"999999999", "3"},
+        {"999999999999999", "3"},
+        {"9999999999999999999", "1"},
+        {"1", "3"},
+        {"0.000000001", "999999999"},
+        {"123456789.123456789", "0.000000007"},
+    };
+
+    constexpr auto ITERATIONS = 1000000;
+
+    for (const auto& bench_case : bench_cases) {
+        const PrecisedFloat dividend{bench_case.dividend};
+        const PrecisedFloat divisor{bench_case.divisor};
+
+        const auto measure = [&dividend] (const auto& divisor, PrecisedFloat& result) {
+            const auto start = std::chrono::steady_clock::now();
+            for (auto i = 0; i < ITERATIONS; ++i) {
+                result = dividend;
+                result /= divisor;
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            return std::chrono::duration<double, std::nano>(elapsed).count() / ITERATIONS;
+        };
+
+        PrecisedFloat result;
+        const auto ns_per_op = measure(divisor, result);
+        const auto prepared_ns_per_op = measure(PrecisedFloat::Divisor{divisor}, result);
+
+        std::printf("%24s / %-20s = %-40s %10.1f ns/op %10.1f ns/op (Divisor)\n",
+                    bench_case.dividend.c_str(), bench_case.divisor.c_str(), result.str().c_str(), ns_per_op, prepared_ns_per_op);
+    }
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+//
+// bench_expressions.cpp
+//
+// (a + b) * c - d over 10M rows with the operators of PrecisedFloat next to
+// the same expression started with lazy().
+//
+
+#include "../precised_float_expressions.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using precised_float_expressions::lazy;
+
+int main() {
+    constexpr auto ROWS_COUNT = 10'000'000;
+    constexpr auto REPETITIONS = 10;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> price_distribution{-99'999'999, 99'999'999};
+    std::uniform_int_distribution<long long> quantity_distribution{-10'000, 10'000};
+    const PrecisedFloat cents{std::string{"0.0001"}};
+
+    std::vector<PrecisedFloat> a, b, c, d;
+    for (auto i = 0; i < ROWS_COUNT; ++i) {
+        a.push_back(PrecisedFloat{price_distribution(generator)} * cents);
+        b.push_back(PrecisedFloat{price_distribution(generator)} * cents);
+        c.push_back(PrecisedFloat{quantity_distribution(generator)});
+        d.push_back(PrecisedFloat{price_distribution(generator)} * cents);
+    }
+
+    const auto report = [](const char* name, const std::chrono::steady_clock::duration elapsed) {
+        const auto milliseconds = std::chrono::duration<double, std::milli>(elapsed).count() / REPETITIONS;
+        std::printf("%-28s %8.2f ms  %6.2f ns/row\n", name, milliseconds, milliseconds * 1e6 / ROWS_COUNT);
+    };
+
+    std::vector<PrecisedFloat> results(ROWS_COUNT);
+    auto start = std::chrono::steady_clock::now();
+    for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+        for (auto i = 0; i < ROWS_COUNT; ++i) {
+            results[i] = (a[i] + b[i]) * c[i] - d[i];
+        }
+    }
+    report("operators", std::chrono::steady_clock::now() - start);
+
+    std::vector<PrecisedFloat> lazy_results(ROWS_COUNT);
+    start = std::chrono::steady_clock::now();
+    for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+        for (auto i = 0; i < ROWS_COUNT; ++i) {
+            lazy_results[i] = (lazy(a[i]) + b[i]) * c[i] - d[i];
+        }
+    }
+    report("lazy() expression", std::chrono::steady_clock::now() - start);
+
+    for (auto i = 0; i < ROWS_COUNT; i += ROWS_COUNT / 7) {
+        if (lazy_results[i].str() != results[i].str()) {
+            std::printf("  mismatch at %d: %s != %s\n", i, lazy_results[i].str().c_str(), results[i].str().c_str());
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+//
+// bench_fma.cpp
+//
+// Settlement amounts price * quantity + fee over 10M rows as operator* and
+// operator+ next to fma() for one row at a time and for spans.
+//
+
+#include "../precised_float.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+int main() {
+    constexpr auto ROWS_COUNT = 10'000'000;
+    constexpr auto REPETITIONS = 10;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> price_distribution{1, 99'999'999};
+    std::uniform_int_distribution<long long> quantity_distribution{-10'000, 10'000};
+    std::uniform_int_distribution<long long> fee_distribution{-999, 0};
+    const PrecisedFloat cents{std::string{"0.0001"}};
+
+    std::vector<PrecisedFloat> prices;
+    std::vector<PrecisedFloat> quantities;
+    std::vector<PrecisedFloat> fees;
+    for (auto i = 0; i < ROWS_COUNT; ++i) {
+        prices.push_back(PrecisedFloat{price_distribution(generator)} * cents);
+        quantities.push_back(PrecisedFloat{quantity_distribution(generator)});
+        fees.push_back(PrecisedFloat{fee_distribution(generator)} * PrecisedFloat{std::string{"0.01"}});
+    }
+
+    const auto report = [](const char* name, const std::chrono::steady_clock::duration elapsed) {
+        const auto milliseconds = std::chrono::duration<double, std::milli>(elapsed).count() / REPETITIONS;
+        std::printf("%-28s %8.2f ms  %6.2f ns/row\n", name, milliseconds, milliseconds * 1e6 / ROWS_COUNT);
+    };
+
+    std::vector<PrecisedFloat> amounts(ROWS_COUNT);
+    auto start = std::chrono::steady_clock::now();
+    for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+        for (auto i = 0; i < ROWS_COUNT; ++i) {
+            amounts[i] = prices[i] * quantities[i] + fees[i];
+        }
+    }
+    report("operator* and operator+", std::chrono::steady_clock::now() - start);
+
+    std::vector<PrecisedFloat> fused_amounts(ROWS_COUNT);
+    start = std::chrono::steady_clock::now();
+    for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+        for (auto i = 0; i < ROWS_COUNT; ++i) {
+            fused_amounts[i] = fma(prices[i], quantities[i], fees[i]);
+        }
+    }
+    report("fma()", std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+        fma(prices, quantities, fees, fused_amounts);
+    }
+    report("fma() over spans", std::chrono::steady_clock::now() - start);
+
+    for (auto i = 0; i < ROWS_COUNT; i += ROWS_COUNT / 7) {
+        if (fused_amounts[i].str() != amounts[i].str()) {
+            std::printf("  mismatch at %d: %s != %s\n", i, fused_amounts[i].str().c_str(), amounts[i].str().c_str());
+        }
+    }
+
+    return 0;
+}
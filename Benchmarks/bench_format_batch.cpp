@@ -0,0 +1,60 @@
+//
+// bench_format_batch.cpp
+//
+// CSV export of 10M prices with up to four fraction digits, one per line:
+// str() appended value by value next to format_batch() with the scalar and
+// the AVX2 kernels into one preallocated buffer.
+//
+
+#include "../precised_float_formatting.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+int main() {
+    constexpr auto VALUES_COUNT = 10'000'000;
+    constexpr auto REPETITIONS = 5;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> price_distribution{-99'999'999, 99'999'999};
+    std::vector<PrecisedFloat> prices;
+    prices.reserve(VALUES_COUNT);
+    for (auto i = 0; i < VALUES_COUNT; ++i) {
+        prices.push_back(PrecisedFloat{price_distribution(generator)} * PrecisedFloat{std::string{"0.0001"}});
+    }
+    const std::span<const PrecisedFloat> price_span{prices};
+
+    std::vector<char> buffer(VALUES_COUNT * (PrecisedFloat::MAX_CHARS + 1));
+    const auto measure = [](const char* name, const auto& format) {
+        std::size_t size = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            size = format();
+        }
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / REPETITIONS;
+        std::printf("%-28s %8.2f ms  %6.2f ns/value  %6.2f GB/s\n", name, seconds * 1e3, seconds * 1e9 / VALUES_COUNT, size / seconds / 1e9);
+    };
+
+    measure("str() per value", [&prices] {
+        std::string text;
+        for (const auto& price : prices) {
+            text += price.str();
+            text += '\n';
+        }
+        return text.size();
+    });
+    measure("format_batch(), scalar", [&price_span, &buffer] {
+        const auto result = format_batch(price_span, buffer.data(), buffer.data() + buffer.size(), ',', 1, PrecisedFloatColumn::Kernels::SCALAR);
+        return static_cast<std::size_t>(result.ptr - buffer.data());
+    });
+    measure("format_batch(), AVX2", [&price_span, &buffer] {
+        const auto result = format_batch(price_span, buffer.data(), buffer.data() + buffer.size(), ',', 1, PrecisedFloatColumn::Kernels::AVX2);
+        return static_cast<std::size_t>(result.ptr - buffer.data());
+    });
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+//
+// bench_mixed_arithmetic.cpp
+//
+// Operators of PrecisedFloat with integer operands over 10M prices: amounts
+// by integer quantities, price shifts and comparisons with integer thresholds.
+//
+
+#include "../precised_float.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+int main() {
+    constexpr auto ROWS_COUNT = 10'000'000;
+    constexpr auto REPETITIONS = 10;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> price_distribution{-99'999'999, 99'999'999};
+    std::uniform_int_distribution<int> quantity_distribution{-10'000, 10'000};
+    const PrecisedFloat cents{std::string{"0.0001"}};
+
+    std::vector<PrecisedFloat> prices;
+    std::vector<int> quantities;
+    for (auto i = 0; i < ROWS_COUNT; ++i) {
+        prices.push_back(PrecisedFloat{price_distribution(generator)} * cents);
+        quantities.push_back(quantity_distribution(generator));
+    }
+
+    const auto report = [](const char* name, const std::chrono::steady_clock::duration elapsed, const long long checksum) {
+        const auto milliseconds = std::chrono::duration<double, std::milli>(elapsed).count() / REPETITIONS;
+        std::printf("%-28s %8.2f ms  %6.2f ns/row  (%lld)\n", name, milliseconds, milliseconds * 1e6 / ROWS_COUNT, checksum);
+    };
+
+    std::vector<PrecisedFloat> results(ROWS_COUNT);
+    const auto measure = [&](const char* name, const auto& operation) {
+        long long checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            for (auto i = 0; i < ROWS_COUNT; ++i) {
+                checksum += operation(i);
+            }
+        }
+        report(name, std::chrono::steady_clock::now() - start, checksum);
+    };
+
+    measure("price * quantity", [&](const int i) {
+        results[i] = prices[i] * quantities[i];
+        return 0;
+    });
+    measure("price + quantity", [&](const int i) {
+        results[i] = prices[i] + quantities[i];
+        return 0;
+    });
+    measure("quantity - price", [&](const int i) {
+        results[i] = quantities[i] - prices[i];
+        return 0;
+    });
+    measure("price < 1000", [&](const int i) {
+        return prices[i] < 1000 ? 1 : 0;
+    });
+    measure("price == quantity", [&](const int i) {
+        return prices[i] == quantities[i] ? 1 : 0;
+    });
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+//
+// bench_parse_batch.cpp
+//
+// Ingestion of 10M comma and newline separated prices with up to four fraction
+// digits: a split loop of the string constructor next to parse_batch() with the
+// scalar and the AVX2 kernels.
+//
+
+#include "../precised_float_parsing.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+int main() {
+    constexpr auto VALUES_COUNT = 10'000'000;
+    constexpr auto REPETITIONS = 5;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> price_distribution{-99'999'999, 99'999'999};
+    std::string text;
+    for (auto i = 0; i < VALUES_COUNT; ++i) {
+        text += (PrecisedFloat{price_distribution(generator)} * PrecisedFloat{std::string{"0.0001"}}).str();
+        text += i % 8 == 7 ? '\n' : ',';
+    }
+
+    const auto measure = [&text](const char* name, const auto& parse) {
+        std::vector<PrecisedFloat> p_floats;
+        p_floats.reserve(VALUES_COUNT);
+        const auto start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            p_floats.clear();
+            parse(p_floats);
+        }
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / REPETITIONS;
+        std::printf("%-28s %8.2f ms  %6.2f ns/value  %6.2f GB/s  (%s)\n", name, seconds * 1e3, seconds * 1e9 / VALUES_COUNT,
+                    text.size() / seconds / 1e9, p_floats.back().str().c_str());
+    };
+
+    measure("string constructor", [&text](std::vector<PrecisedFloat>& p_floats) {
+        std::size_t first = 0;
+        while (first < text.size()) {
+            const auto last = text.find_first_of(",\n", first);
+            p_floats.emplace_back(std::string_view{text}.substr(first, last - first));
+            first = last + 1;
+        }
+    });
+    measure("parse_batch(), scalar", [&text](std::vector<PrecisedFloat>& p_floats) {
+        parse_batch(text, p_floats, ',', PrecisedFloatColumn::Kernels::SCALAR);
+    });
+    measure("parse_batch(), AVX2", [&text](std::vector<PrecisedFloat>& p_floats) {
+        parse_batch(text, p_floats, ',', PrecisedFloatColumn::Kernels::AVX2);
+    });
+
+    return 0;
+}
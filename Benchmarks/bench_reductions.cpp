@@ -0,0 +1,68 @@
+//
+// bench_reductions.cpp
+//
+// reduce_sum(), reduce_minmax() and dot() over 10M prices with four fraction
+// digits on one thread and on every core, next to a loop of operator+=.
+//
+
+#include "../precised_float_reductions.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main() {
+    constexpr auto VALUES_COUNT = 10'000'000;
+    constexpr auto REPETITIONS = 10;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> price_distribution{-99'999'999, 99'999'999};
+    std::uniform_int_distribution<long long> quantity_distribution{-10'000, 10'000};
+    const PrecisedFloat cents{std::string{"0.0001"}};
+
+    std::vector<PrecisedFloat> prices;
+    std::vector<PrecisedFloat> quantities;
+    prices.reserve(VALUES_COUNT);
+    quantities.reserve(VALUES_COUNT);
+    for (auto i = 0; i < VALUES_COUNT; ++i) {
+        prices.push_back(PrecisedFloat{price_distribution(generator)} * cents);
+        quantities.push_back(PrecisedFloat{quantity_distribution(generator)});
+    }
+    const std::span<const PrecisedFloat> price_span{prices};
+    const std::span<const PrecisedFloat> quantity_span{quantities};
+
+    const auto measure = [](const char* name, const auto& reduce) {
+        PrecisedFloat result;
+        const auto start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            result = reduce();
+        }
+        const auto milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / REPETITIONS;
+        std::printf("%-36s %8.2f ms  (%s)\n", name, milliseconds, result.str().c_str());
+    };
+
+    measure("operator+=", [&prices] {
+        PrecisedFloat sum{0};
+        for (const auto& price : prices) {
+            sum += price;
+        }
+        return sum;
+    });
+
+    std::vector<unsigned> threads_counts{1};
+    if (std::thread::hardware_concurrency() > 1) {
+        threads_counts.push_back(std::thread::hardware_concurrency());
+    }
+    for (const auto threads_count : threads_counts) {
+        std::printf("%u thread(s)\n", threads_count);
+        measure("  reduce_sum()", [&] { return reduce_sum(price_span, threads_count); });
+        measure("  reduce_minmax(), max", [&] { return reduce_minmax(price_span, threads_count).second; });
+        measure("  dot()", [&] { return dot(price_span, quantity_span, threads_count); });
+    }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+//
+// bench_serialization.cpp
+//
+// Snapshot of 10M prices with up to four fraction digits: the text of
+// format_batch() read back by parse_batch() next to one binary block written
+// by encode() and read back by decode(), both into preallocated buffers.
+//
+
+#include "../precised_float_formatting.h"
+#include "../precised_float_parsing.h"
+#include "../precised_float_serialization.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+int main() {
+    constexpr auto VALUES_COUNT = 10'000'000;
+    constexpr auto REPETITIONS = 5;
+
+    // A random walk as a price series moves
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> step_distribution{-500, 500};
+    std::vector<PrecisedFloat> prices;
+    prices.reserve(VALUES_COUNT);
+    long long price = 10'000'000;
+    for (auto i = 0; i < VALUES_COUNT; ++i) {
+        price += step_distribution(generator);
+        prices.push_back(PrecisedFloat{price} * PrecisedFloat{std::string{"0.0001"}});
+    }
+    const std::span<const PrecisedFloat> price_span{prices};
+
+    const auto measure = [](const char* name, const auto& run) {
+        std::size_t size = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (auto repetition = 0; repetition < REPETITIONS; ++repetition) {
+            size = run();
+        }
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / REPETITIONS;
+        std::printf("%-24s %8.2f ms  %6.2f ns/value  %10zu bytes\n", name, seconds * 1e3, seconds * 1e9 / VALUES_COUNT, size);
+    };
+
+    std::vector<char> text(VALUES_COUNT * (PrecisedFloat::MAX_CHARS + 1));
+    std::size_t text_size = 0;
+    std::vector<PrecisedFloat> parsed;
+    parsed.reserve(VALUES_COUNT);
+    measure("format_batch()", [&] {
+        text_size = static_cast<std::size_t>(format_batch(price_span, text.data(), text.data() + text.size()).ptr - text.data());
+        return text_size;
+    });
+    measure("parse_batch()", [&] {
+        parsed.clear();
+        parse_batch(std::string_view{text.data(), text_size}, parsed);
+        return text_size;
+    });
+
+    std::vector<std::byte> bytes(max_encoded_size<PrecisedFloat>(VALUES_COUNT));
+    std::byte* bytes_end = nullptr;
+    std::vector<PrecisedFloat> decoded(VALUES_COUNT);
+    measure("encode()", [&] {
+        bytes_end = encode(price_span, bytes.data(), bytes.data() + bytes.size());
+        return static_cast<std::size_t>(bytes_end - bytes.data());
+    });
+    measure("decode()", [&] {
+        decode(std::span<const std::byte>{bytes.data(), bytes_end}, std::span<PrecisedFloat>{decoded});
+        return static_cast<std::size_t>(bytes_end - bytes.data());
+    });
+
+    std::printf("%s\n", parsed.back() == prices.back() && decoded.back() == prices.back() ? "restored" : "MISMATCH");
+    return 0;
+}
@@ -0,0 +1,53 @@
+//
+// bench_sort.cpp
+//
+// std::sort and the radix sort over 10M PrecisedFloat values with mixed magnitude orders and signs.
+//
+
+#include "../precised_float.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+int main() {
+    constexpr auto VALUES_COUNT = 10'000'000;
+
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<long long> integer_distribution{-999'999'999'999, 999'999'999'999};
+    std::uniform_int_distribution<int> divisor_distribution{0, 6};
+
+    std::vector<PrecisedFloat> values;
+    values.reserve(VALUES_COUNT);
+    for (auto i = 0; i < VALUES_COUNT; ++i) {
+        PrecisedFloat value{integer_distribution(generator)};
+        for (auto divisions = divisor_distribution(generator); divisions > 0; --divisions) {
+            value /= 10;
+        }
+        values.push_back(value);
+    }
+
+    auto radix_sorted_values = values;
+
+    auto start = std::chrono::steady_clock::now();
+    std::sort(values.begin(), values.end());
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("std::sort of %d values: %.1f ms (sorted: %s)\n",
+                VALUES_COUNT, std::chrono::duration<double, std::milli>(elapsed).count(),
+                std::is_sorted(values.begin(), values.end()) ? "yes" : "no");
+
+    start = std::chrono::steady_clock::now();
+    sort(std::span<PrecisedFloat>{radix_sorted_values});
+    elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("radix sort of %d values: %.1f ms (sorted: %s)\n",
+                VALUES_COUNT, std::chrono::duration<double, std::milli>(elapsed).count(),
+                std::is_sorted(radix_sorted_values.begin(), radix_sorted_values.end()) ? "yes" : "no");
+
+    return 0;
+}
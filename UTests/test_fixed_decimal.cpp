@@ -0,0 +1,97 @@
+#include "pch.h"
+#include "../fixed_decimal.h"
+
+#include <compare>
+#include <limits>
+#include <vector>
+
+using Price     = FixedDecimal<4>;
+using Quantity  = FixedDecimal<0>;
+using Rate      = FixedDecimal<8>;
+
+TEST(TestFixedDecimal, TestConversionFromPrecisedFloat) {
+    struct TestCase {
+        std::string str;
+        std::string expected;
+    };
+    const std::vector<TestCase> test_cases{
+        {"0",          "0.0"},
+        {"1.5",        "1.5"},
+        {"-1.5",       "-1.5"},
+        {"123.4567",   "123.4567"},
+        {"123.456789", "123.4567"}, // truncated to the scale
+        {"-0.00009",   "0.0"},
+        {"NaN",        "NaN"},
+        {"99999999999999999", "NaN"}, // does not fit after rescaling
+    };
+
+    for (const auto& test_case : test_cases) {
+        const Price price{PrecisedFloat{test_case.str}};
+        EXPECT_EQ(price.str(), test_case.expected);
+    }
+}
+
+TEST(TestFixedDecimal, TestArithmetic) {
+    const Price price{PrecisedFloat{std::string{"101.25"}}};
+    const Price fee{PrecisedFloat{std::string{"0.0125"}}};
+    const Quantity quantity{300};
+    const Rate rate{PrecisedFloat{std::string{"0.00012345"}}};
+
+    EXPECT_EQ((price + fee).str(), "101.2625");
+    EXPECT_EQ((fee - price).str(), "-101.2375");
+    EXPECT_EQ((price * quantity).str(), "30375.0");
+    EXPECT_EQ((price * 3).str(), "303.75");
+    EXPECT_EQ((price * rate).str(), "0.0124");
+    EXPECT_EQ((price / quantity).str(), "0.3375");
+    EXPECT_EQ((-price / fee).str(), "-8100.0");
+    EXPECT_TRUE((price / Price{}).is_nan());
+
+    EXPECT_TRUE(fee < price);
+    EXPECT_EQ(Price{Rate{PrecisedFloat{std::string{"1.23456789"}}}}.str(), "1.2345");
+    EXPECT_EQ(Rate{price}.str(), "101.25");
+
+    EXPECT_EQ(static_cast<PrecisedFloat>(price).str(), "101.25");
+    EXPECT_EQ((static_cast<PrecisedFloat>(price) + PrecisedFloat{std::string{"0.0001"}}).str(), "101.2501");
+}
+
+TEST(TestFixedDecimal, TestNaNAndOverflow) {
+    const Price one{1};
+    const Price nan{PrecisedFloat{}};
+    const auto max = Price::from_raw(std::numeric_limits<long long>::max());
+
+    EXPECT_TRUE(Price{1'000'000'000'000'000LL}.is_nan());
+    EXPECT_TRUE(Price{18'446'744'073'709'551'615ULL}.is_nan());
+    EXPECT_EQ(Price{-922'337'203'685'477LL}.str(), "-922337203685477.0");
+    EXPECT_EQ(Price{0ULL}.str(), "0.0");
+
+    EXPECT_TRUE((nan + one).is_nan());
+    EXPECT_TRUE((nan - one).is_nan());
+    EXPECT_TRUE((one - nan).is_nan());
+    EXPECT_TRUE((max + one).is_nan());
+    EXPECT_TRUE((-max - one - one).is_nan());
+    EXPECT_EQ((max - one + one).raw(), max.raw());
+
+    auto sum = one;
+    sum += nan;
+    EXPECT_TRUE(sum.is_nan());
+    sum = one;
+    sum -= max;
+    EXPECT_EQ(sum.raw(), 10'000 - std::numeric_limits<long long>::max());
+
+    EXPECT_TRUE((nan * 2).is_nan());
+    EXPECT_TRUE((max * 2).is_nan());
+    EXPECT_TRUE((one * 1'000'000'000'000'000LL).is_nan());
+    EXPECT_EQ((one * -3).str(), "-3.0");
+    EXPECT_EQ((-one * 2u).str(), "-2.0");
+    EXPECT_EQ((max * -1).raw(), -max.raw());
+
+    // NaN is unordered and equal to nothing
+    EXPECT_FALSE(nan == nan);
+    EXPECT_TRUE(nan != nan);
+    EXPECT_FALSE(nan < one);
+    EXPECT_FALSE(one < nan);
+    EXPECT_FALSE(nan <= nan);
+    EXPECT_EQ(nan <=> one, std::partial_ordering::unordered);
+    EXPECT_EQ(one <=> Price{PrecisedFloat{std::string{"1.0"}}}, std::partial_ordering::equivalent);
+    EXPECT_TRUE(-one < one);
+}
@@ -0,0 +1,64 @@
+//
+// test_helpers.h
+//
+
+#pragma once
+
+#include "../precised_float_column.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace precised_float_tests {
+    using Kernels = PrecisedFloatColumn::Kernels;
+
+    // Unsupported kernels fall back to the best supported ones
+    inline const std::vector<Kernels> ALL_KERNELS{Kernels::SCALAR, Kernels::AVX2, Kernels::AVX512};
+
+    // Mantissas below <max_mantissa>, from <min_fraction_digits> to <max_fraction_digits> fraction digits and NaN
+    // for one of <nan_period> numbers, none when it is 0
+    struct Shape {
+        unsigned long long max_mantissa = ~0ull;
+        unsigned min_fraction_digits = 0;
+        unsigned max_fraction_digits = 19;
+        unsigned nan_period = 16;
+    };
+
+    // Signs, zeros and mantissas of every length up to the mantissa of PFloat, overflow included
+    template<typename PFloat>
+    PFloat make_p_float(std::mt19937_64& generator, const Shape& shape) {
+        constexpr auto MANTISSA_BITS = std::min(64, PFloat::MANTISSA_DIGITS);
+
+        if (shape.nan_period != 0 && generator() % shape.nan_period == 0) {
+            return PFloat{};
+        }
+
+        auto mantissa = generator() >> (64 - MANTISSA_BITS) >> (generator() % MANTISSA_BITS);
+        if (shape.max_mantissa != ~0ull) {
+            mantissa %= shape.max_mantissa;
+        }
+
+        PFloat p_float{mantissa};
+        const auto fraction_digits = shape.min_fraction_digits + generator() % (shape.max_fraction_digits - shape.min_fraction_digits + 1);
+        for (auto divisions = fraction_digits; divisions > 0; --divisions) {
+            p_float *= PFloat{std::string{"0.1"}};
+        }
+
+        return generator() % 2 == 0 ? p_float : -p_float;
+    }
+
+    template<typename PFloat = PrecisedFloat>
+    std::vector<PFloat> make_p_floats(const std::size_t count, const unsigned seed, const Shape& shape = {}) {
+        std::mt19937_64 generator{seed};
+        std::vector<PFloat> p_floats;
+        p_floats.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            p_floats.push_back(make_p_float<PFloat>(generator, shape));
+        }
+
+        return p_floats;
+    }
+}
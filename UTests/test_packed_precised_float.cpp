@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "../packed_precised_float.h"
+
+#include <vector>
+
+TEST(TestPackedPrecisedFloat, TestRoundTrip) {
+    static_assert(sizeof(PackedPrecisedFloat) == 8);
+    static_assert(sizeof(PackedPrecisedFloat32) == 4);
+    static_assert(PackedPrecisedFloat::MAGNITUDE_ORDER_MAX >= PrecisedFloat::MAGNITUDE_ORDER_LIMIT);
+
+    struct TestCase {
+        std::string str;
+        std::string expected;
+    };
+    const std::vector<TestCase> test_cases{
+        {"0",                        "0.0"},
+        {"-0.0",                     "-0.0"},
+        {"1.25",                     "1.25"},
+        {"-123456.789",              "-123456.789"},
+        {"0.000000000000000001",     "0.000000000000000001"},
+        {"1.500",                    "1.5"},
+        {"288230376151711743",       "288230376151711743.0"},  // MANTISSA_MAX
+        {"-28823037615171174.3",     "-28823037615171174.3"},
+        {"288230376151711744",       "NaN"},                   // does not fit into 58 bits
+        {"2882303761517117440",      "NaN"},                   // integer zeros stay in the mantissa
+        {"NaN",                      "NaN"},
+    };
+
+    for (const auto& test_case : test_cases) {
+        const PrecisedFloat p_float{test_case.str};
+        const PackedPrecisedFloat packed{p_float};
+        EXPECT_EQ(packed.str(), test_case.expected) << test_case.str;
+        EXPECT_EQ(PackedPrecisedFloat::fits(p_float), test_case.expected != "NaN" || p_float.is_nan()) << test_case.str;
+        EXPECT_EQ(packed.is_nan(), test_case.expected == "NaN");
+        EXPECT_EQ(PackedPrecisedFloat::from_raw(packed.raw()).str(), packed.str());
+    }
+
+    // Trailing fraction zeros are dropped from mantissas and magnitude orders which do not fit
+    const auto half = PrecisedFloat{std::string{"100000000000000000"}} * PrecisedFloat{std::string{"0.5"}};
+    EXPECT_EQ(PackedPrecisedFloat{half}.str(), "50000000000000000.0");
+    const auto tiny = PrecisedFloat{std::string{"0.0000000000000001"}} * PrecisedFloat{std::string{"0.0000000000000005"}};
+    EXPECT_EQ(PackedPrecisedFloat{tiny}.str(), "NaN");
+    const auto one = PrecisedFloat{std::string{"1000000000000000000"}} * PrecisedFloat{std::string{"0.000000000000000001"}};
+    const auto exact = one * PrecisedFloat{std::string{"0.000000000000000001"}};
+    EXPECT_TRUE(PackedPrecisedFloat::fits(exact));
+    EXPECT_EQ(PackedPrecisedFloat{exact}.str(), "0.000000000000000001");
+
+    // try_pack() reports what the constructor turns into NaN
+    PackedPrecisedFloat packed{PrecisedFloat{1}};
+    EXPECT_TRUE(PackedPrecisedFloat::try_pack(PrecisedFloat{std::string{"-28823037615171174.3"}}, packed));
+    EXPECT_EQ(packed.str(), "-28823037615171174.3");
+    EXPECT_TRUE(PackedPrecisedFloat::try_pack(half, packed));
+    EXPECT_EQ(packed.str(), "50000000000000000.0");
+    EXPECT_TRUE(PackedPrecisedFloat::try_pack(PrecisedFloat{}, packed));
+    EXPECT_TRUE(packed.is_nan());
+    packed = PackedPrecisedFloat{PrecisedFloat{1}};
+    EXPECT_FALSE(PackedPrecisedFloat::try_pack(PrecisedFloat{std::string{"288230376151711744"}}, packed));
+    EXPECT_TRUE(packed.is_nan());
+    // Magnitude order 31 above MAGNITUDE_ORDER_MAX
+    const auto order_31 = PrecisedFloat{std::string{"0.0000000000000003"}} * PrecisedFloat{std::string{"0.000000000000001"}};
+    EXPECT_EQ(order_31.str(), "0.0000000000000000000000000000003");
+    packed = PackedPrecisedFloat{PrecisedFloat{1}};
+    EXPECT_FALSE(PackedPrecisedFloat::try_pack(order_31, packed));
+    EXPECT_TRUE(packed.is_nan());
+    PackedPrecisedFloat32 packed_32;
+    EXPECT_FALSE(PackedPrecisedFloat32::try_pack(PrecisedFloat32{std::string{"134217728"}}, packed_32));
+
+    EXPECT_EQ(PackedPrecisedFloat{}.str(), "NaN");
+    EXPECT_EQ(PackedPrecisedFloat32{PrecisedFloat32{std::string{"-1234567.8"}}}.str(), "-1234567.8");
+    EXPECT_EQ(PackedPrecisedFloat32{PrecisedFloat32{std::string{"134217728"}}}.str(), "NaN");
+}
@@ -1,6 +1,11 @@
 #include "pch.h"
 #include "../precised_float.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <unordered_map>
 #include <vector>
 
 TEST(TestInitialization, TestInitializationFromString) {
@@ -52,6 +57,19 @@ TEST(TestInitialization, TestInitializationFromString) {
         {"11234.56", "11234.56"},
         {"112345.6", "112345.6"},
         {"112345.6", "112345.6"},
+
+        {"100",                  "100.0"},
+        {"1000000000",           "1000000000.0"},
+        {"-12.50",               "-12.5"},
+        {"18446744073709551615", "18446744073709551615.0"},
+        {"18446744073709551616", "NaN"},
+        {"0.000000000000000001", "0.000000000000000001"},
+        {"0.0000000000000000001", "NaN"},
+        {"1.",                   "NaN"},
+        {".5",                   "NaN"},
+        {"-.5",                  "NaN"},
+        {"-",                    "NaN"},
+        {"1.5.3",                "NaN"},
     };
 
     for (const auto& test_case : test_cases) {
@@ -62,7 +80,7 @@ TEST(TestInitialization, TestInitializationFromString) {
 
 template<typename T>
 struct NumberTestCase {
-    using number_t = typename T;
+    using number_t = T;
     number_t    number;
     std::string expected;
 };
@@ -162,3 +180,551 @@ TEST(TestInitialization, TestInitializationFromFloatingPoint) {
         EXPECT_EQ(pf.str(), test_case.expected);
     }
 }
+
+TEST(TestInitialization, TestInitializationFromFloatingPointShortest) {
+    using DoubleTestCase = NumberTestCase<double>;
+    const std::vector<DoubleTestCase> double_test_cases{
+        {0.3,                                                         "0.3"},
+        {123456.1234567891,                                           "123456.1234567891"},
+        {1e15 + 0.3,                                                  "1000000000000000.2"},
+        {9007199254740993.0,                                          "9007199254740992.0"},
+        {1e19,                                                        "10000000000000000000.0"},
+        {2e19,                                                        "NaN"},
+        {5e-19,                                                       "0.000000000000000001"},
+        {4e-19,                                                       "0.0"},
+        {-1e-30,                                                      "-0.0"},
+        {std::numeric_limits<double>::denorm_min(),                   "0.0"},
+        {std::numeric_limits<double>::infinity(),                     "NaN"},
+        {std::numeric_limits<double>::quiet_NaN(),                    "NaN"},
+    };
+
+    for (const auto& test_case : double_test_cases) {
+        PrecisedFloat pf{test_case.number};
+        EXPECT_EQ(pf.str(), test_case.expected);
+    }
+
+    EXPECT_EQ(PrecisedFloat{0.1f}.str(), "0.1");
+    EXPECT_EQ(PrecisedFloat{-1.5e-5f}.str(), "-0.000015");
+    EXPECT_EQ(PrecisedFloat32{0.123456789}.str(), "0.12345679");
+    EXPECT_EQ(PrecisedFloat32{12345.678901}.str(), "NaN");
+    EXPECT_EQ(PrecisedFloat32{99.99}.str(), "99.99");
+    EXPECT_EQ(PrecisedFloat32{123.456}.str(), "123.456");
+    EXPECT_EQ(PrecisedFloat32{1234.5678}.str(), "1234.5678");
+    EXPECT_EQ((PrecisedFloat32{2} * 99.99).str(), "199.98");
+}
+
+TEST(TestConversion, TestConversionToArithmetic) {
+    const std::vector<std::string> strings{
+        "0.0", "-0.0", "0.1", "-0.3", "1.0", "123.456", "0.000000000000000001", "-9.999999999999999999",
+        "9007199254740993.0", "18446744073709551615.0", "1844674407370955161.5", "0.100000000000000005",
+        "5.0000000000000001"
+    };
+
+    for (const auto& string : strings) {
+        const PrecisedFloat pf{string};
+        EXPECT_EQ(static_cast<double>(pf), std::strtod(string.c_str(), nullptr)) << string;
+        EXPECT_EQ(static_cast<float>(pf), std::strtof(string.c_str(), nullptr)) << string;
+    }
+
+    EXPECT_TRUE(std::isnan(static_cast<double>(PrecisedFloat{})));
+    EXPECT_TRUE(std::signbit(static_cast<double>(PrecisedFloat{std::string{"-0.0"}})));
+    EXPECT_EQ(static_cast<int>(PrecisedFloat{std::string{"-12.9"}}), -12);
+    EXPECT_EQ(static_cast<unsigned>(PrecisedFloat{std::string{"3.99"}}), 3u);
+    EXPECT_EQ(static_cast<long long>(PrecisedFloat{}), 0);
+
+    // Magnitude orders out of the power of ten tables
+    const auto tiny = PrecisedFloat{std::string{"0.000000001"}} * PrecisedFloat{std::string{"0.000000000000000001"}};
+    EXPECT_EQ(static_cast<double>(tiny), 1e-27);
+    EXPECT_EQ(static_cast<float>(PrecisedFloat32{std::string{"0.00000001"}} * PrecisedFloat32{std::string{"0.0000003"}}), 3e-15f);
+
+    const std::vector<PrecisedFloat> p_floats{
+        PrecisedFloat{std::string{"1.25"}}, PrecisedFloat{std::string{"-0.1"}}, PrecisedFloat{1} / PrecisedFloat{3},
+        PrecisedFloat{}, tiny, PrecisedFloat{std::string{"18446744073709551615"}}
+    };
+    std::vector<double> doubles(p_floats.size() + 1, 7.0);
+    to_double(p_floats, doubles);
+    for (std::size_t i = 0; i < p_floats.size(); ++i) {
+        const auto expected = static_cast<double>(p_floats[i]);
+        EXPECT_TRUE(doubles[i] == expected || (std::isnan(doubles[i]) && std::isnan(expected))) << i;
+    }
+    EXPECT_EQ(doubles.back(), 7.0);
+}
+
+TEST(TestArithmetic, TestAdditionWithDifferentMagnitudeOrders) {
+    struct TestCase {
+        std::string lhs;
+        std::string rhs;
+        std::string expected;
+    };
+    const std::vector<TestCase> test_cases{
+        {"1.5",                 "0.25",  "1.75"},
+        {"0.25",                "1.5",   "1.75"},
+        {"-1.5",                "-0.25", "-1.75"},
+        {"1.5",                 "-0.25", "1.25"},
+        {"0.25",                "-1.5",  "-1.25"},
+        {"9007199254740993",    "0.001", "9007199254740993.001"},
+        {"9876543210987654321", "0.1",   "NaN"}, // rescaled mantissa does not fit
+    };
+
+    for (const auto& test_case : test_cases) {
+        PrecisedFloat pf{test_case.lhs};
+        pf += PrecisedFloat{test_case.rhs};
+        EXPECT_EQ(pf.str(), test_case.expected);
+    }
+}
+
+TEST(TestArithmetic, TestFloatingPointOperands) {
+    // The floating point operand is converted by the constructor, p_float - number subtracts the number
+    EXPECT_EQ((PrecisedFloat{5} - 1.5).str(), "3.5");
+    EXPECT_EQ((1.5 - PrecisedFloat{5}).str(), "-3.5");
+    EXPECT_EQ((PrecisedFloat{std::string{"-0.25"}} - 0.75f).str(), "-1.00");
+    EXPECT_EQ((PrecisedFloat{5} + 1.5).str(), "6.5");
+    EXPECT_EQ((PrecisedFloat{5} - 0.0).str(), "5.0");
+    EXPECT_EQ((PrecisedFloat{} - 1.5).str(), "NaN");
+}
+
+TEST(TestArithmetic, TestMultiplicationOverflow) {
+    const PrecisedFloat big{std::string{"4294967296"}};
+
+    EXPECT_EQ((big * PrecisedFloat{std::string{"4294967295"}}).str(), "18446744069414584320.0");
+    EXPECT_EQ((big * big).str(), "NaN");
+    EXPECT_EQ((big * PrecisedFloat{std::string{"-0.0000000001"}}).str(), "-0.4294967296");
+    EXPECT_EQ((PrecisedFloat32{65536} * PrecisedFloat32{65536}).str(), "NaN");
+}
+
+TEST(TestArithmetic, TestIntegerOperands) {
+    const std::vector<std::string> strings{
+        "NaN", "0.0", "-0.0", "0.000", "-0.000", "1.5", "-1.5", "2.0", "-2.00", "0.0001", "-1000.25",
+        "18446744073709551615.0", "1844674407370955161.5", "-0.0000000000000000001"
+    };
+    const std::vector<long long> integers{0, 1, -1, 2, -2, 1000, -1000, 1844674407370955161, std::numeric_limits<long long>::min()};
+
+    // The same results as with BasicPrecisedFloat{<integer>}, including the state of zero and the magnitude order
+    for (const auto& string : strings) {
+        const PrecisedFloat pf{string};
+        for (const auto integer : integers) {
+            const PrecisedFloat integer_pf{integer};
+            auto temp_pf = integer_pf;
+            temp_pf += pf;
+            EXPECT_EQ((pf + integer).str(), temp_pf.str()) << string << " + " << integer;
+            EXPECT_EQ((integer + pf).str(), temp_pf.str()) << integer << " + " << string;
+            temp_pf = integer_pf;
+            temp_pf -= pf;
+            EXPECT_EQ((integer - pf).str(), temp_pf.str()) << integer << " - " << string;
+            EXPECT_EQ((pf - integer).str(), (pf - integer_pf).str()) << string << " - " << integer;
+            EXPECT_EQ((pf * integer).str(), (pf * integer_pf).str()) << string << " * " << integer;
+            EXPECT_EQ((integer * pf).str(), (integer_pf * pf).str()) << integer << " * " << string;
+
+            EXPECT_EQ(pf == integer, pf == integer_pf) << string << " == " << integer;
+            EXPECT_EQ(pf != integer, pf != integer_pf) << string << " != " << integer;
+            EXPECT_EQ(pf < integer, pf < integer_pf) << string << " < " << integer;
+            EXPECT_EQ(integer < pf, integer_pf < pf) << integer << " < " << string;
+            EXPECT_EQ(pf <= integer, pf <= integer_pf) << string << " <= " << integer;
+            EXPECT_EQ(integer >= pf, integer_pf >= pf) << integer << " >= " << string;
+        }
+    }
+
+    PrecisedFloat pf{std::string{"-2.5"}};
+    pf += 3;
+    EXPECT_EQ(pf.str(), "0.5");
+    pf -= 1;
+    EXPECT_EQ(pf.str(), "-0.5");
+    pf *= -4;
+    EXPECT_EQ(pf.str(), "2.0");
+
+    // Narrow integers are promoted before negation, wide ones may not fit
+    EXPECT_EQ((PrecisedFloat{1} + static_cast<short>(-5)).str(), "-4.0");
+    EXPECT_EQ(PrecisedFloat{static_cast<signed char>(-7)}.str(), "-7.0");
+    EXPECT_EQ((PrecisedFloat32{1} * 4'294'967'296ULL).str(), "NaN");
+    EXPECT_EQ((PrecisedFloat32{1} + 4'294'967'296ULL).str(), "NaN");
+    EXPECT_FALSE(PrecisedFloat32{1} < 4'294'967'296ULL);
+    EXPECT_EQ((PrecisedFloat{std::string{"0.1"}} + 1844674407370955162).str(), "NaN");
+    EXPECT_TRUE(PrecisedFloat{std::string{"0.1"}} < 1844674407370955162);
+}
+
+TEST(TestArithmetic, TestAccumulator) {
+    PrecisedFloat::Accumulator tenths;
+    for (auto i = 0; i < 10; ++i) {
+        tenths.add(PrecisedFloat{std::string{"0.1"}});
+    }
+    EXPECT_EQ(tenths.result().str(), "1.0");
+
+    // Magnitude orders differ and the running sum goes far beyond <mantissa_t>, the result is still exact
+    const std::vector<PrecisedFloat> p_floats{
+        PrecisedFloat{std::string{"18446744073709551615"}}, PrecisedFloat{std::string{"18446744073709551615"}},
+        PrecisedFloat{std::string{"0.000000000000000001"}}, PrecisedFloat{std::string{"-18446744073709551615"}},
+        PrecisedFloat{std::string{"-18446744073709551615"}}, PrecisedFloat{std::string{"-2.5"}}
+    };
+    PrecisedFloat::Accumulator accumulator;
+    accumulator.add(p_floats);
+    EXPECT_EQ(accumulator.result().str(), "-2.499999999999999999");
+
+    PrecisedFloat::Accumulator other;
+    other.add(PrecisedFloat{std::string{"2.499999999999999999"}});
+    other.add(PrecisedFloat{std::string{"0.5"}} * PrecisedFloat{std::string{"0.000000000000000001"}});
+    accumulator.merge(other);
+    EXPECT_EQ(accumulator.result().str(), "0.0000000000000000005");
+
+    // Fraction digits which do not fit are truncated, an integer part which does not fit is NaN
+    PrecisedFloat::Accumulator big;
+    big.add(PrecisedFloat{std::string{"1000000000000000000"}});
+    big.add(PrecisedFloat{std::string{"0.123"}});
+    EXPECT_EQ(big.result().str(), "1000000000000000000.1");
+    big.add(PrecisedFloat{std::string{"9000000000000000000"}});
+    EXPECT_EQ(big.result().str(), "10000000000000000000.0");
+    big.add(PrecisedFloat{std::string{"9000000000000000000"}});
+    EXPECT_EQ(big.result().str(), "NaN");
+
+    PrecisedFloat::Accumulator nan;
+    nan.add(PrecisedFloat{1});
+    nan.add(PrecisedFloat{});
+    EXPECT_EQ(nan.result().str(), "NaN");
+    EXPECT_EQ(PrecisedFloat::Accumulator{}.merge(nan).result().str(), "NaN");
+    EXPECT_EQ(PrecisedFloat::Accumulator{}.result().str(), "0.0");
+
+    PrecisedFloat32::Accumulator narrow;
+    narrow.add(PrecisedFloat32{4'000'000'000u});
+    narrow.add(PrecisedFloat32{4'000'000'000u});
+    narrow.add(PrecisedFloat32{4'000'000'000u} * PrecisedFloat32{-1});
+    narrow.add(PrecisedFloat32{std::string{"-0.25"}});
+    EXPECT_EQ(narrow.result().str(), "3999999999.0");
+}
+
+TEST(TestArithmetic, TestFusedMultiplyAdd) {
+    struct TestCase {
+        std::string multiplicand;
+        std::string multiplier;
+        std::string addend;
+        std::string expected;
+    };
+    const std::vector<TestCase> test_cases{
+        {"12.5",                "3",                    "0.25",                     "37.75"},
+        {"1.10",                "2",                    "-2.20",                    "0.0"},
+        {"-0.5",                "0.000000000000000001", "1",                        "0.9999999999999999995"},
+        {"0.0",                 "-3",                   "0",                        "-0.0"},
+        // The product alone does not fit into <mantissa_t>
+        {"4294967296",          "4294967296",           "-18446744073709551615",    "1.0"},
+        {"-4294967296",         "4294967296.5",         "18446744073709551616.0",   "NaN"},
+        {"123456789.123456789", "1000",                 "0.000000001",              "123456789123.456789"},
+        {"10000000000",         "10000000000",          "0",                        "NaN"},
+        {"NaN",                 "1",                    "1",                        "NaN"},
+        {"1",                   "1",                    "NaN",                      "NaN"},
+    };
+
+    std::vector<PrecisedFloat> multiplicands;
+    std::vector<PrecisedFloat> multipliers;
+    std::vector<PrecisedFloat> addends;
+    for (const auto& test_case : test_cases) {
+        const PrecisedFloat multiplicand{test_case.multiplicand};
+        const PrecisedFloat multiplier{test_case.multiplier};
+        const PrecisedFloat addend{test_case.addend};
+        const auto result = fma(multiplicand, multiplier, addend);
+        EXPECT_EQ(result.str(), test_case.expected) << test_case.multiplicand << " * " << test_case.multiplier << " + " << test_case.addend;
+
+        // The same number in the same representation as without the fusion when that does not overflow
+        const auto unfused_result = multiplicand * multiplier + addend;
+        if (!unfused_result.is_nan()) {
+            EXPECT_EQ(result.str(), unfused_result.str());
+        }
+
+        multiplicands.push_back(multiplicand);
+        multipliers.push_back(multiplier);
+        addends.push_back(addend);
+    }
+
+    std::vector<PrecisedFloat> results(test_cases.size() + 1);
+    fma(multiplicands, multipliers, addends, results);
+    for (std::size_t i = 0; i < test_cases.size(); ++i) {
+        EXPECT_EQ(results[i].str(), test_cases[i].expected);
+    }
+    EXPECT_TRUE(results.back().is_nan());
+
+    EXPECT_EQ(fma(PrecisedFloat32{65536}, PrecisedFloat32{65536}, PrecisedFloat32{-1}).str(), "4294967295.0");
+}
+
+TEST(TestArithmetic, TestDivision) {
+    struct TestCase {
+        std::string dividend;
+        std::string divisor;
+        std::string expected;
+    };
+    const std::vector<TestCase> test_cases{
+        {"1",                   "4",           "0.25"},
+        {"-1",                  "4",           "-0.25"},
+        {"1",                   "-4",          "-0.25"},
+        {"-1",                  "-4",          "0.25"},
+        {"7.5",                 "2.5",         "3.0"},
+        {"0.75",                "0.5",         "1.5"},
+        {"1",                   "3",           "0.333333333333333333"},
+        {"2",                   "3",           "0.666666666666666666"},
+        {"999999999999999",     "3",           "333333333333333.0"},
+        {"999999999999999",     "7",           "142857142857142.7142"},
+        {"9999999999999999999", "1",           "9999999999999999999.0"},
+        {"123456789.123456789", "0.000000007", "17636684160493827.0"},
+        {"0",                   "3",           "0.0"},
+        {"1",                   "0",           "NaN"},
+        {"NaN",                 "3",           "NaN"},
+    };
+
+    for (const auto& test_case : test_cases) {
+        PrecisedFloat pf{test_case.dividend};
+        pf /= PrecisedFloat{test_case.divisor};
+        EXPECT_EQ(pf.str(), test_case.expected);
+    }
+}
+
+TEST(TestArithmetic, TestDivisionByPreparedDivisor) {
+    const std::vector<std::string> dividends{"1", "-1", "7.5", "0.75", "999999999999999", "9999999999999999999", "123456789.123456789", "0.000000001", "0", "NaN"};
+    const std::vector<std::string> divisors{"1", "3", "-4", "2.5", "0.5", "7", "365", "0.000000007", "999999999", "0", "NaN"};
+
+    for (const auto& divisor_string : divisors) {
+        const PrecisedFloat divisor{divisor_string};
+        const PrecisedFloat::Divisor prepared_divisor{divisor};
+
+        std::vector<PrecisedFloat> batch;
+        for (const auto& dividend_string : dividends) {
+            const PrecisedFloat dividend{dividend_string};
+            EXPECT_EQ((dividend / prepared_divisor).str(), (dividend / divisor).str());
+
+            batch.push_back(dividend);
+        }
+
+        divide(batch, prepared_divisor);
+        for (std::size_t i = 0; i < dividends.size(); ++i) {
+            EXPECT_EQ(batch[i].str(), (PrecisedFloat{dividends[i]} / divisor).str());
+        }
+    }
+}
+
+TEST(TestMantissaWidth, TestMixedWidthArithmetic) {
+    static_assert(sizeof(PrecisedFloat32) < sizeof(PrecisedFloat));
+    static_assert(std::numeric_limits<PrecisedFloat32>::max_exponent10 == 8);
+    static_assert(std::numeric_limits<PrecisedFloat64>::max_exponent10 == 18);
+
+    const PrecisedFloat32 narrow{std::string{"4294967295"}};
+    const PrecisedFloat wide{std::string{"0.5"}};
+
+    const auto sum = narrow + wide;
+    static_assert(std::is_same<decltype(sum), const PrecisedFloat>::value);
+    EXPECT_EQ(sum.str(), "4294967295.5");
+    EXPECT_EQ((wide - narrow).str(), "-4294967294.5");
+    EXPECT_TRUE(wide < narrow);
+
+    EXPECT_EQ((narrow + PrecisedFloat32{1}).str(), "NaN"); // does not fit into 32 bits
+    EXPECT_EQ(PrecisedFloat32{PrecisedFloat{std::string{"99999999999"}}}.str(), "NaN");
+    EXPECT_EQ(PrecisedFloat32{PrecisedFloat{std::string{"1.25"}}}.str(), "1.25");
+    EXPECT_EQ((PrecisedFloat32{1} / PrecisedFloat32{3}).str(), "0.33333333");
+
+#if defined(__SIZEOF_INT128__)
+    const PrecisedFloat128 huge{std::string{"123456789012345678901234567890.5"}};
+    EXPECT_EQ((huge + wide).str(), "123456789012345678901234567891.0");
+    EXPECT_EQ((huge / PrecisedFloat128{3}).str(), "41152263004115226300411522630.166666666");
+    EXPECT_EQ((huge / PrecisedFloat128::Divisor{PrecisedFloat128{3}}).str(), "41152263004115226300411522630.166666666");
+#endif
+}
+
+TEST(TestComparison, TestThreeWayComparison) {
+    struct TestCase {
+        std::string lhs;
+        std::string rhs;
+        std::partial_ordering expected;
+    };
+    const std::vector<TestCase> test_cases{
+        {"1.5",                 "1.5",                 std::partial_ordering::equivalent},
+        {"1.5",                 "1.50",                std::partial_ordering::equivalent},
+        {"0",                   "-0.0",                std::partial_ordering::equivalent},
+        {"1.5",                 "1.25",                std::partial_ordering::greater},
+        {"1.25",                "1.5",                 std::partial_ordering::less},
+        {"-1.5",                "-1.25",               std::partial_ordering::less},
+        {"-1.5",                "1.25",                std::partial_ordering::less},
+        {"0",                   "-0.001",              std::partial_ordering::greater},
+        {"0",                   "0.001",               std::partial_ordering::less},
+        {"9876543210987654321", "0.1",                 std::partial_ordering::greater}, // alignment overflows
+        {"0.1",                 "9876543210987654321", std::partial_ordering::less},
+        {"-0.1",                "-9876543210987654321", std::partial_ordering::greater},
+        {"NaN",                 "1",                   std::partial_ordering::unordered},
+        {"NaN",                 "NaN",                 std::partial_ordering::unordered},
+    };
+
+    for (const auto& test_case : test_cases) {
+        const PrecisedFloat lhs{test_case.lhs};
+        const PrecisedFloat rhs{test_case.rhs};
+        EXPECT_EQ(lhs.compare(rhs), test_case.expected);
+
+        EXPECT_EQ(lhs == rhs, test_case.expected == 0);
+        EXPECT_EQ(lhs != rhs, test_case.expected != 0);
+        EXPECT_EQ(lhs < rhs, test_case.expected < 0);
+        EXPECT_EQ(lhs > rhs, test_case.expected > 0);
+        EXPECT_EQ(lhs <= rhs, test_case.expected <= 0);
+        EXPECT_EQ(lhs >= rhs, test_case.expected >= 0);
+    }
+
+    EXPECT_TRUE(1 < PrecisedFloat{std::string{"1.5"}});
+    EXPECT_FALSE(2 < PrecisedFloat{std::string{"1.5"}});
+}
+
+TEST(TestComparison, TestNormalizationAndHash) {
+    struct TestCase {
+        PrecisedFloat p_float;
+        std::string   expected;
+    };
+    const std::vector<TestCase> test_cases{
+        {PrecisedFloat{std::string{"1.25"}} + PrecisedFloat{std::string{"0.25"}}, "1.5"},
+        {PrecisedFloat{std::string{"2.5"}} * PrecisedFloat{std::string{"4"}},     "10.0"},
+        {PrecisedFloat{std::string{"0.5"}} - PrecisedFloat{std::string{"0.5"}},   "0.0"},
+        {PrecisedFloat{std::string{"-1.5"}} + PrecisedFloat{std::string{"1.5"}},  "0.0"},
+        {PrecisedFloat{std::string{"0.000001"}} * PrecisedFloat{1000000},         "1.0"},
+        {PrecisedFloat{std::string{"-12.34"}},                                    "-12.34"},
+    };
+
+    const std::hash<PrecisedFloat> hasher;
+    for (const auto& test_case : test_cases) {
+        auto canonical = test_case.p_float;
+        EXPECT_EQ(canonical.normalize().str(), test_case.expected);
+        EXPECT_EQ(canonical, test_case.p_float);
+        EXPECT_EQ(hasher(canonical), hasher(test_case.p_float));
+    }
+
+    // More trailing zeros than a 32-bit mantissa has digits
+    PrecisedFloat32 zero{0};
+    for (auto divisions = 0; divisions < 17; ++divisions) {
+        zero *= PrecisedFloat32{std::string{"0.1"}};
+    }
+    EXPECT_EQ(zero.str(), "0.00000000000000000");
+    EXPECT_EQ(zero.normalize().str(), "0.0");
+
+    std::unordered_map<PrecisedFloat, int> prices;
+    prices[PrecisedFloat{std::string{"1.5"}}] = 1;
+    prices[PrecisedFloat{std::string{"1.25"}} + PrecisedFloat{std::string{"0.25"}}] += 1;
+    prices[PrecisedFloat{std::string{"0"}}] = 1;
+    prices[PrecisedFloat{std::string{"-1.5"}} + PrecisedFloat{std::string{"1.5"}}] += 1;
+    EXPECT_EQ(prices.size(), 2u);
+    EXPECT_EQ(prices[PrecisedFloat{std::string{"1.5"}}], 2);
+    EXPECT_EQ(prices[PrecisedFloat{std::string{"0"}}], 2);
+}
+
+TEST(TestComparison, TestSortKeyAndRadixSort) {
+    const std::vector<std::string> strings{
+        "NaN", "1.5", "-1.5", "0", "-0.0", "1.25", "-1.25", "0.001", "-0.001", "100", "99.999",
+        "9876543210987654321", "-9876543210987654321", "0.000000000000000001", "-0.000000000000000001",
+        "9999999999999999999", "999999999999999999.9", "0.5", "5", "50", "NaN", "12345.678", "-12345.6789"
+    };
+
+    std::vector<PrecisedFloat> p_floats;
+    for (const auto& string : strings) {
+        p_floats.emplace_back(string);
+    }
+    // Equal to 1.5 but not in canonical form
+    p_floats.push_back(PrecisedFloat{std::string{"1.25"}} + PrecisedFloat{std::string{"0.25"}});
+
+    for (const auto& lhs : p_floats) {
+        for (const auto& rhs : p_floats) {
+            if (lhs.is_nan() || rhs.is_nan()) {
+                continue;
+            }
+
+            const auto key_ordering = lhs.sort_key() <=> rhs.sort_key();
+            EXPECT_EQ(key_ordering == 0, lhs == rhs) << lhs.str() << " " << rhs.str();
+            EXPECT_EQ(key_ordering < 0, lhs < rhs) << lhs.str() << " " << rhs.str();
+        }
+    }
+
+    sort(std::span<PrecisedFloat>{p_floats});
+
+    EXPECT_TRUE(p_floats[p_floats.size() - 2].is_nan());
+    EXPECT_TRUE(p_floats[p_floats.size() - 1].is_nan());
+    EXPECT_TRUE(std::is_sorted(p_floats.begin(), p_floats.end() - 2));
+    EXPECT_EQ(p_floats.front().str(), "-9876543210987654321.0");
+    EXPECT_EQ(p_floats[p_floats.size() - 3].str(), "9999999999999999999.0");
+}
+
+TEST(TestInitialization, TestFromChars) {
+    struct TestCase {
+        std::string str;
+        std::size_t expected_length;
+        std::errc   expected_error;
+        std::string expected;
+    };
+    const std::vector<TestCase> test_cases{
+        {"1.5;2.5",               3,  std::errc{},                    "1.5"},
+        {"-100 ",                 4,  std::errc{},                    "-100.0"},
+        {"42.",                   2,  std::errc{},                    "42.0"},
+        {"7.25e3",                4,  std::errc{},                    "7.25"},
+        {"abc",                   0,  std::errc::invalid_argument,    "NaN"},
+        {"-.5",                   0,  std::errc::invalid_argument,    "NaN"},
+        {"",                      0,  std::errc::invalid_argument,    "NaN"},
+        {"99999999999999999999;", 20, std::errc::result_out_of_range, "NaN"},
+    };
+
+    for (const auto& test_case : test_cases) {
+        PrecisedFloat pf;
+        const auto [end, error] = from_chars(test_case.str.data(), test_case.str.data() + test_case.str.size(), pf);
+        EXPECT_EQ(static_cast<std::size_t>(end - test_case.str.data()), test_case.expected_length);
+        EXPECT_EQ(error, test_case.expected_error);
+        EXPECT_EQ(pf.str(), test_case.expected);
+    }
+
+    PrecisedFloat pf{std::string_view{"12.5"}};
+    pf = std::string_view{"3"};
+    EXPECT_EQ(pf.str(), "3.0");
+    pf = "-0.75";
+    EXPECT_EQ(pf.str(), "-0.75");
+}
+
+TEST(TestFormatting, TestToChars) {
+    const std::vector<std::string> strings{
+        "NaN", "0.0", "-0.0", "1.0", "-1.0", "0.001", "-0.000000000000000001", "12345.678",
+        "-9876543210987654321.0", "18446744073709551615.0", "1.234567890123456789", "100.0"
+    };
+
+    for (const auto& string : strings) {
+        const PrecisedFloat pf{string};
+
+        char buffer[PrecisedFloat::MAX_CHARS];
+        const auto [end, error] = pf.to_chars(std::begin(buffer), std::end(buffer));
+        EXPECT_EQ(error, std::errc{});
+        EXPECT_EQ(std::string(buffer, end), string);
+
+        const auto [short_end, short_error] = pf.to_chars(std::begin(buffer), std::begin(buffer) + string.size() - 1);
+        EXPECT_EQ(short_error, std::errc::value_too_large);
+
+        std::ostringstream stream;
+        stream << pf << ';';
+        EXPECT_EQ(stream.str(), string + ';');
+    }
+
+    // Magnitude orders above MAGNITUDE_ORDER_LIMIT do not fit into MAX_CHARS, the stream falls back to str()
+    const auto tiny = PrecisedFloat{std::string{"0.000000001"}} * PrecisedFloat{std::string{"0.000000000000000001"}};
+    std::ostringstream stream;
+    stream << tiny;
+    EXPECT_EQ(stream.str(), "0.000000000000000000000000001");
+    EXPECT_EQ(tiny.str(), stream.str());
+}
+
+TEST(TestInitialization, TestConstexpr) {
+    using namespace precised_float_literals;
+
+    constexpr auto fee_rate = 0.0025_pf;
+    constexpr auto tick_size = 1'000.05_pf;
+    static_assert(fee_rate == PrecisedFloat{std::string_view{"0.0025"}});
+    static_assert(fee_rate * 400 + 1 == 2);
+    static_assert(-fee_rate < 0 && -fee_rate > -1);
+    static_assert(tick_size - 1000 == 0.05_pf);
+    static_assert(1_pf / 3 > 0.333_pf && 1_pf / 3 < 0.334_pf);
+    static_assert((1_pf / 0).is_nan());
+    static_assert(0.000000000000000001_pf * 1'000'000'000'000'000'000 == 1);
+    // 1e3_pf, 0x10_pf and 18446744073709551616_pf do not compile, the string constructor makes them NaN
+    static_assert(PrecisedFloat{std::string_view{"1e3"}}.is_nan());
+    static_assert(PrecisedFloat{std::string_view{"18446744073709551616"}}.is_nan());
+
+    constexpr PrecisedFloat32 narrow = PrecisedFloat32{std::string_view{"1.5"}} / PrecisedFloat32{7};
+    EXPECT_EQ(narrow.str(), "0.21428571");
+    EXPECT_EQ(fee_rate.str(), "0.0025");
+    EXPECT_EQ(tick_size.str(), "1000.05");
+    EXPECT_EQ((-fee_rate).str(), "-0.0025");
+    EXPECT_EQ((-PrecisedFloat{}).str(), "NaN");
+#if defined(__SIZEOF_INT128__)
+    constexpr PrecisedFloat128 wide = PrecisedFloat128{std::string_view{"12345678901234567890.5"}} * 3 / 7;
+    EXPECT_EQ(wide.str(), (PrecisedFloat128{std::string{"12345678901234567890.5"}} * PrecisedFloat128{3} / PrecisedFloat128{7}).str());
+#endif
+}
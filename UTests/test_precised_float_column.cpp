@@ -0,0 +1,193 @@
+#include "pch.h"
+#include "../precised_float_column.h"
+#include "test_helpers.h"
+
+#include <string>
+#include <vector>
+
+using precised_float_tests::ALL_KERNELS;
+using precised_float_tests::make_p_floats;
+
+namespace {
+    // NaN, signs, zeros and mantissas close to the overflow at one magnitude order or a few of them
+    precised_float_tests::Shape shape(const bool single_order) {
+        return {.min_fraction_digits = single_order ? 2u : 0u, .max_fraction_digits = 2, .nan_period = 8};
+    }
+
+    void expect_same(const PrecisedFloatColumn& column, const std::vector<PrecisedFloat>& expected) {
+        ASSERT_EQ(column.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(column[i].str(), expected[i].str()) << i;
+        }
+    }
+}
+
+TEST(TestPrecisedFloatColumn, TestStorage) {
+    const std::vector<PrecisedFloat> p_floats{
+        PrecisedFloat{std::string{"1.25"}}, PrecisedFloat{std::string{"-0.001"}}, PrecisedFloat{}, PrecisedFloat{7}
+    };
+
+    PrecisedFloatColumn column{p_floats};
+    EXPECT_FALSE(column.has_shared_scale());
+    expect_same(column, p_floats);
+
+    column.push_back(PrecisedFloat{std::string{"-3.5"}});
+    column.set(0, PrecisedFloat{std::string{"9.99"}});
+    EXPECT_EQ(column.size(), 5u);
+    EXPECT_EQ(column[0].str(), "9.99");
+    EXPECT_EQ(column[4].str(), "-3.5");
+
+    // Extra fraction digits are truncated, mantissas which do not fit are NaN
+    PrecisedFloatColumn shared{p_floats, 2};
+    EXPECT_TRUE(shared.has_shared_scale());
+    EXPECT_EQ(shared.shared_magnitude_order(), 2);
+    EXPECT_EQ(shared[0].str(), "1.25");
+    EXPECT_EQ(shared[1].str(), "-0.00");
+    EXPECT_EQ(shared[2].str(), "NaN");
+    EXPECT_EQ(shared[3].str(), "7.00");
+    shared.set(3, PrecisedFloat{std::string{"9999999999999999999"}});
+    EXPECT_EQ(shared[3].str(), "NaN");
+
+    shared.resize(6);
+    EXPECT_EQ(shared[5].str(), "0.00");
+}
+
+TEST(TestPrecisedFloatColumn, TestElementWiseResults) {
+    // lhs, rhs, lhs + rhs, lhs - rhs, lhs * rhs, lhs * -1.5
+    const std::vector<std::vector<std::string>> cases{
+        {"1.25",                 "2.5",        "3.75",                   "-1.25",                  "3.125",                  "-1.875"},
+        {"-0.001",               "0.001",      "-0.000",                 "-0.002",                 "-0.000001",              "0.0015"},
+        {"0.5",                  "-0.5",       "0.0",                    "1.0",                    "-0.25",                  "-0.75"},
+        {"9999999999999999999",  "1",          "10000000000000000000.0", "9999999999999999998.0",  "9999999999999999999.0",  "NaN"},
+        {"18446744073709551615", "1",          "NaN",                    "18446744073709551614.0", "18446744073709551615.0", "NaN"},
+        {"4294967296",           "4294967296", "8589934592.0",           "0.0",                    "NaN",                    "-6442450944.0"},
+        {"NaN",                  "1",          "NaN",                    "NaN",                    "NaN",                    "NaN"},
+    };
+
+    std::vector<PrecisedFloat> lhs_p_floats;
+    std::vector<PrecisedFloat> rhs_p_floats;
+    for (const auto& test_case : cases) {
+        lhs_p_floats.push_back(PrecisedFloat{test_case[0]});
+        rhs_p_floats.push_back(PrecisedFloat{test_case[1]});
+    }
+    const PrecisedFloatColumn lhs{lhs_p_floats};
+    const PrecisedFloatColumn rhs{rhs_p_floats};
+
+    for (const auto kernels : ALL_KERNELS) {
+        PrecisedFloatColumn sums;
+        PrecisedFloatColumn differences;
+        PrecisedFloatColumn products;
+        PrecisedFloatColumn scaled;
+        add(lhs, rhs, sums, kernels);
+        sub(lhs, rhs, differences, kernels);
+        mul(lhs, rhs, products, kernels);
+        scale_by(lhs, PrecisedFloat{std::string{"-1.5"}}, scaled, kernels);
+        for (std::size_t i = 0; i < cases.size(); ++i) {
+            EXPECT_EQ(sums[i].str(), cases[i][2]) << cases[i][0] << " + " << cases[i][1];
+            EXPECT_EQ(differences[i].str(), cases[i][3]) << cases[i][0] << " - " << cases[i][1];
+            EXPECT_EQ(products[i].str(), cases[i][4]) << cases[i][0] << " * " << cases[i][1];
+            EXPECT_EQ(scaled[i].str(), cases[i][5]) << cases[i][0] << " * -1.5";
+        }
+    }
+}
+
+TEST(TestPrecisedFloatColumn, TestElementWiseOperations) {
+    // Odd sizes leave tails for the scalar code after the SIMD loops
+    constexpr std::size_t COUNT = 1003;
+
+    for (const bool single_order : {true, false}) {
+        const auto lhs_p_floats = make_p_floats(COUNT, 1, shape(single_order));
+        const auto rhs_p_floats = make_p_floats(COUNT, 2, shape(single_order));
+        const PrecisedFloatColumn lhs{lhs_p_floats};
+        const PrecisedFloatColumn rhs{rhs_p_floats};
+
+        std::vector<PrecisedFloat> sums;
+        std::vector<PrecisedFloat> differences;
+        std::vector<PrecisedFloat> products;
+        std::vector<PrecisedFloat> scaled;
+        const auto factor = PrecisedFloat{std::string{"-1.5"}};
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            sums.push_back(lhs_p_floats[i] + rhs_p_floats[i]);
+            differences.push_back(lhs_p_floats[i] - rhs_p_floats[i]);
+            products.push_back(lhs_p_floats[i] * rhs_p_floats[i]);
+            scaled.push_back(lhs_p_floats[i] * factor);
+        }
+
+        for (const auto kernels : ALL_KERNELS) {
+            PrecisedFloatColumn result;
+            add(lhs, rhs, result, kernels);
+            expect_same(result, sums);
+            sub(lhs, rhs, result, kernels);
+            expect_same(result, differences);
+            mul(lhs, rhs, result, kernels);
+            expect_same(result, products);
+            scale_by(lhs, factor, result, kernels);
+            expect_same(result, scaled);
+        }
+    }
+}
+
+TEST(TestPrecisedFloatColumn, TestSharedScale) {
+    constexpr std::size_t COUNT = 517;
+
+    const auto prices = make_p_floats(COUNT, 3, shape(true));
+    const auto quantities = make_p_floats(COUNT, 4, shape(true));
+
+    for (const auto kernels : ALL_KERNELS) {
+        const PrecisedFloatColumn price_column{prices, 2};
+        const PrecisedFloatColumn quantity_column{quantities, 2};
+        const PrecisedFloatColumn other_scale_column{quantities, 4};
+
+        PrecisedFloatColumn result;
+        add(price_column, quantity_column, result, kernels);
+        EXPECT_TRUE(result.has_shared_scale());
+        EXPECT_EQ(result.shared_magnitude_order(), 2);
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            ASSERT_EQ(result[i].str(), (price_column[i] + quantity_column[i]).str()) << i;
+        }
+
+        mul(price_column, quantity_column, result, kernels);
+        EXPECT_EQ(result.shared_magnitude_order(), 4);
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            ASSERT_EQ(result[i].str(), (price_column[i] * quantity_column[i]).str()) << i;
+        }
+
+        sub(price_column, other_scale_column, result, kernels);
+        EXPECT_EQ(result.shared_magnitude_order(), 4);
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            ASSERT_EQ(result[i].str(), (price_column[i] - other_scale_column[i]).str()) << i;
+        }
+
+        // A shared scale operand next to per-number orders
+        const PrecisedFloatColumn mixed_column{make_p_floats(COUNT, 5, shape(false))};
+        add(price_column, mixed_column, result, kernels);
+        EXPECT_FALSE(result.has_shared_scale());
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            ASSERT_EQ(result[i].str(), (price_column[i] + mixed_column[i]).str()) << i;
+        }
+    }
+}
+
+TEST(TestPrecisedFloatColumn, TestResultAliasing) {
+    const auto lhs_p_floats = make_p_floats(100, 6, shape(true));
+    const auto rhs_p_floats = make_p_floats(90, 7, shape(true));
+
+    for (const auto kernels : ALL_KERNELS) {
+        PrecisedFloatColumn lhs{lhs_p_floats, 2};
+        const PrecisedFloatColumn rhs{rhs_p_floats};
+        add(lhs, rhs, lhs, kernels);
+
+        // The result is as long as the shorter operand and no longer has a shared scale
+        EXPECT_EQ(lhs.size(), rhs_p_floats.size());
+        EXPECT_FALSE(lhs.has_shared_scale());
+        for (std::size_t i = 0; i < rhs_p_floats.size(); ++i) {
+            ASSERT_EQ(lhs[i].str(), (lhs_p_floats[i] + rhs_p_floats[i]).str()) << i;
+        }
+
+        PrecisedFloatColumn self{lhs_p_floats};
+        mul(self, self, self, kernels);
+        for (std::size_t i = 0; i < lhs_p_floats.size(); ++i) {
+            ASSERT_EQ(self[i].str(), (lhs_p_floats[i] * lhs_p_floats[i]).str()) << i;
+        }
+    }
+}
@@ -0,0 +1,170 @@
+#include "pch.h"
+#include "../precised_float_column_file.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    std::string temp_path(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+}
+
+TEST(TestColumnFile, TestZoneMaps) {
+    const auto path = temp_path("precised_float_zone_maps.pfc");
+    const std::vector<PrecisedFloat> p_floats{PrecisedFloat{std::string{"1.5"}}, PrecisedFloat{}, PrecisedFloat{std::string{"-2.25"}},
+                                              PrecisedFloat{std::string{"3"}}, PrecisedFloat{}, PrecisedFloat{}, PrecisedFloat{},
+                                              PrecisedFloat{}, PrecisedFloat{std::string{"10.001"}}, PrecisedFloat{std::string{"-0.0"}}};
+    ASSERT_TRUE(PrecisedFloatColumnFile::write(path.c_str(), std::span<const PrecisedFloat>{p_floats}, 4));
+
+    const PrecisedFloatColumnFile file{path.c_str()};
+    ASSERT_TRUE(file.is_open());
+    EXPECT_EQ(file.size(), p_floats.size());
+    EXPECT_EQ(file.block_size(), 4u);
+    ASSERT_EQ(file.blocks_count(), 3u);
+
+    const std::vector<std::vector<std::string>> zone_maps{{"4", "1", "-2.25", "3.0"}, {"4", "4", "NaN", "NaN"}, {"2", "0", "-0.0", "10.001"}};
+    for (std::size_t block = 0; block < zone_maps.size(); ++block) {
+        const auto zone_map = file.zone_map(block);
+        EXPECT_EQ(std::to_string(zone_map.count), zone_maps[block][0]) << block;
+        EXPECT_EQ(std::to_string(zone_map.nan_count), zone_maps[block][1]) << block;
+        EXPECT_EQ(zone_map.min.str(), zone_maps[block][2]) << block;
+        EXPECT_EQ(zone_map.max.str(), zone_maps[block][3]) << block;
+    }
+
+    std::vector<PrecisedFloat> block(4);
+    EXPECT_EQ(file.read_block(2, block), 2u);
+    EXPECT_EQ(block[0].str(), "10.001");
+    EXPECT_EQ(file.read_block(2, std::span<PrecisedFloat>{block}.first(1)), 0u);
+    EXPECT_EQ(file.read_block(3, block), 0u);
+
+    std::vector<std::size_t> indexes;
+    EXPECT_EQ(file.scan(PrecisedFloat{0}, PrecisedFloat{3}, [&indexes](const std::size_t index, const PrecisedFloat&) {
+        indexes.push_back(index);
+    }), 3u);
+    EXPECT_EQ(indexes, (std::vector<std::size_t>{0, 3, 9}));
+    EXPECT_EQ(file.count(PrecisedFloat{-3}, PrecisedFloat{20}), 5u);
+    EXPECT_EQ(file.count(PrecisedFloat{11}, PrecisedFloat{20}), 0u);
+    EXPECT_EQ(file.count(PrecisedFloat{3}, PrecisedFloat{0}), 0u);
+    EXPECT_EQ(file.count(PrecisedFloat{}, PrecisedFloat{20}), 0u);
+
+    EXPECT_TRUE(PrecisedFloatColumnFile::write(path.c_str(), std::span<const PrecisedFloat>{}));
+    const PrecisedFloatColumnFile empty_file{path.c_str()};
+    ASSERT_TRUE(empty_file.is_open());
+    EXPECT_EQ(empty_file.blocks_count(), 0u);
+    EXPECT_EQ(empty_file.count(PrecisedFloat{-3}, PrecisedFloat{20}), 0u);
+    std::filesystem::remove(path);
+}
+
+TEST(TestColumnFile, TestBigMagnitudeOrders) {
+    // Products have magnitude orders above MAGNITUDE_ORDER_LIMIT, blocks and zone maps keep them exactly
+    const auto path = temp_path("precised_float_big_magnitude_orders.pfc");
+    const auto tiny = PrecisedFloat{std::string{"0.0000000001"}} * PrecisedFloat{std::string{"0.0000000001"}};
+    const std::vector<PrecisedFloat> p_floats{tiny, PrecisedFloat{1}, -tiny * tiny};
+    ASSERT_TRUE(PrecisedFloatColumnFile::write(path.c_str(), std::span<const PrecisedFloat>{p_floats}, 2));
+
+    const PrecisedFloatColumnFile file{path.c_str()};
+    ASSERT_TRUE(file.is_open());
+    EXPECT_EQ(file.zone_map(0).nan_count, 0u);
+    EXPECT_EQ(file.zone_map(0).min.str(), "0.00000000000000000001");
+    EXPECT_EQ(file.zone_map(0).max.str(), "1.0");
+    EXPECT_EQ(file.zone_map(1).min.str(), "-0.0000000000000000000000000000000000000001");
+    EXPECT_EQ(file.count(PrecisedFloat{0}, PrecisedFloat{1}), 2u);
+    EXPECT_EQ(file.count(PrecisedFloat{-1}, PrecisedFloat{0}), 1u);
+
+    std::vector<std::size_t> indexes;
+    EXPECT_EQ(file.scan(PrecisedFloat{0}, PrecisedFloat{1}, [&indexes, &p_floats](const std::size_t index, const PrecisedFloat& p_float) {
+        EXPECT_EQ(p_float.str(), p_floats[index].str());
+        indexes.push_back(index);
+    }), 2u);
+    EXPECT_EQ(indexes, (std::vector<std::size_t>{0, 1}));
+    std::filesystem::remove(path);
+}
+
+TEST(TestColumnFile, TestRangeQueries) {
+    // A random walk with NaN gaps, so zone maps skip some blocks, take some whole and scan the rest
+    const auto path = temp_path("precised_float_range_queries.pfc");
+    std::mt19937_64 generator{9};
+    std::vector<PrecisedFloat> prices;
+    long long price = 100'000;
+    for (auto i = 0; i < 100'000; ++i) {
+        price += static_cast<long long>(generator() % 201) - 100;
+        prices.push_back(generator() % 50 == 0 ? PrecisedFloat{} : PrecisedFloat{price} * PrecisedFloat{std::string{"0.01"}});
+    }
+    ASSERT_TRUE(PrecisedFloatColumnFile::write(path.c_str(), std::span<const PrecisedFloat>{prices}, 1000));
+
+    const PrecisedFloatColumnFile file{path.c_str()};
+    ASSERT_TRUE(file.is_open());
+    ASSERT_EQ(file.blocks_count(), 100u);
+    for (auto query = 0; query < 20; ++query) {
+        const auto low = PrecisedFloat{static_cast<long long>(generator() % 2000)} + PrecisedFloat{500};
+        const auto high = low + PrecisedFloat{static_cast<long long>(generator() % 200)};
+
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < prices.size(); ++i) {
+            if (low <= prices[i] && prices[i] <= high) {
+                expected.push_back(i);
+            }
+        }
+
+        std::vector<std::size_t> indexes;
+        EXPECT_EQ(file.scan(low, high, [&indexes, &prices](const std::size_t index, const PrecisedFloat& p_float) {
+            EXPECT_EQ(p_float.str(), prices[index].str());
+            indexes.push_back(index);
+        }), expected.size());
+        ASSERT_EQ(indexes, expected) << low.str() << " " << high.str();
+        EXPECT_EQ(file.count(low, high), expected.size());
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(TestColumnFile, TestInvalidFiles) {
+    EXPECT_FALSE(PrecisedFloatColumnFile{temp_path("precised_float_missing.pfc").c_str()}.is_open());
+    EXPECT_FALSE(PrecisedFloatColumnFile::write(temp_path("precised_float_missing/column.pfc").c_str(), std::span<const PrecisedFloat>{}));
+
+    const auto path = temp_path("precised_float_invalid.pfc");
+    const std::vector<PrecisedFloat> p_floats(100, PrecisedFloat{std::string{"1.25"}});
+    ASSERT_TRUE(PrecisedFloatColumnFile::write(path.c_str(), std::span<const PrecisedFloat>{p_floats}, 10));
+    const auto file_size = std::filesystem::file_size(path);
+
+    // A scale above MAGNITUDE_ORDER_LIMIT in block 0 and a state no number has in the zone map of block 1: with 64-bit
+    // mantissas the 32-byte header is followed by 48-byte entries with the states at 44, and block 0 by its count and scale
+    {
+        std::fstream stream{path, std::ios::binary | std::ios::in | std::ios::out};
+        stream.seekp(32 + 10 * 48 + 1);
+        stream.put(static_cast<char>(100));
+        stream.seekp(32 + 48 + 44);
+        stream.put(static_cast<char>(5));
+    }
+    {
+        const PrecisedFloatColumnFile corrupt_file{path.c_str()};
+        ASSERT_TRUE(corrupt_file.is_open());
+        EXPECT_TRUE(corrupt_file.zone_map(1).min.is_nan());
+        EXPECT_EQ(corrupt_file.zone_map(1).max.str(), "1.25");
+        std::vector<PrecisedFloat> block(10);
+        EXPECT_EQ(corrupt_file.read_block(0, block), 0u);
+        EXPECT_EQ(corrupt_file.read_block(1, block), 10u);
+        EXPECT_EQ(corrupt_file.count(PrecisedFloat{1}, PrecisedFloat{2}), 90u);
+        EXPECT_EQ(corrupt_file.scan(PrecisedFloat{std::string{"1.25"}}, PrecisedFloat{2}, [](std::size_t, const PrecisedFloat&) {}), 80u);
+    }
+    ASSERT_TRUE(PrecisedFloatColumnFile::write(path.c_str(), std::span<const PrecisedFloat>{p_floats}, 10));
+
+    // Another mantissa type, cut off entries and a cut off block
+    EXPECT_FALSE(BasicPrecisedFloatColumnFile<std::uint32_t>{path.c_str()}.is_open());
+    std::filesystem::resize_file(path, file_size - 1);
+    const PrecisedFloatColumnFile cut_file{path.c_str()};
+    ASSERT_TRUE(cut_file.is_open());
+    std::vector<PrecisedFloat> block(10);
+    EXPECT_EQ(cut_file.read_block(0, block), 10u);
+    EXPECT_EQ(cut_file.read_block(9, block), 0u);
+    std::filesystem::resize_file(path, 100);
+    EXPECT_FALSE(PrecisedFloatColumnFile{path.c_str()}.is_open());
+
+    std::ofstream{path, std::ios::binary} << std::string(200, 'x');
+    EXPECT_FALSE(PrecisedFloatColumnFile{path.c_str()}.is_open());
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,107 @@
+#include "pch.h"
+#include "../precised_float_csv.h"
+#include "test_helpers.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using precised_float_tests::ALL_KERNELS;
+
+namespace {
+    std::string write_file(const std::string& name, const std::string& text) {
+        const auto path = (std::filesystem::temp_directory_path() / name).string();
+        std::ofstream{path, std::ios::binary} << text;
+
+        return path;
+    }
+}
+
+TEST(TestCsvReader, TestRecords) {
+    const auto path = write_file("precised_float_records.csv", "price,name,quantity\r\n"
+                                                               "1.50,abc,-2\r\n"
+                                                               "\r\n"
+                                                               "x,\"q\",0.001\n"
+                                                               "7\n"
+                                                               ",,\n"
+                                                               "-0.25,d,3");
+    const std::vector<std::size_t> columns{2, 0, 2};
+
+    for (const auto kernels : ALL_KERNELS) {
+        std::vector<std::vector<PrecisedFloat>> results;
+        ASSERT_TRUE(read_csv_columns(path.c_str(), columns, results, ',', true, 0, kernels));
+        ASSERT_EQ(results.size(), 3u);
+
+        const std::vector<std::string> quantities{"-2.0", "0.001", "NaN", "NaN", "3.0"};
+        const std::vector<std::string> prices{"1.5", "NaN", "7.0", "NaN", "-0.25"};
+        ASSERT_EQ(results[0].size(), quantities.size());
+        ASSERT_EQ(results[1].size(), prices.size());
+        for (std::size_t i = 0; i < quantities.size(); ++i) {
+            EXPECT_EQ(results[0][i].str(), quantities[i]) << i;
+            EXPECT_EQ(results[1][i].str(), prices[i]) << i;
+            EXPECT_EQ(results[2][i].str(), quantities[i]) << i;
+        }
+    }
+    std::filesystem::remove(path);
+
+    // A separator at the end of the file without a line end is followed by an empty last field
+    const auto open_path = write_file("precised_float_open_record.csv", "1,2\n3,");
+    const std::vector<std::size_t> open_columns{0, 1};
+    for (const auto kernels : ALL_KERNELS) {
+        std::vector<std::vector<PrecisedFloat>> results;
+        ASSERT_TRUE(read_csv_columns(open_path.c_str(), open_columns, results, ',', false, 0, kernels));
+        ASSERT_EQ(results.size(), 2u);
+        ASSERT_EQ(results[0].size(), 2u);
+        ASSERT_EQ(results[1].size(), 2u);
+        EXPECT_EQ(results[0][1].str(), "3.0");
+        EXPECT_EQ(results[1][0].str(), "2.0");
+        EXPECT_TRUE(results[1][1].is_nan());
+    }
+    std::filesystem::remove(open_path);
+
+    std::vector<std::vector<PrecisedFloat>> results;
+    EXPECT_FALSE(read_csv_columns((std::filesystem::temp_directory_path() / "precised_float_missing.csv").string().c_str(),
+                                  columns, results));
+    EXPECT_TRUE(results.empty());
+
+    const auto empty_path = write_file("precised_float_empty.tsv", "");
+    ASSERT_TRUE(read_csv_columns(empty_path.c_str(), columns, results, '\t'));
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_TRUE(results[0].empty());
+    std::filesystem::remove(empty_path);
+}
+
+TEST(TestCsvReader, TestChunks) {
+    // Enough records for every thread to take a few chunks of MIN_CHUNK_SIZE
+    std::mt19937_64 generator{17};
+    std::string text;
+    std::vector<std::vector<PrecisedFloat>> expected(2);
+    for (auto i = 0; i < 50'000; ++i) {
+        const auto price = std::to_string(generator() % 100'000'000) + "." + std::to_string(generator() % 100);
+        const auto quantity = (generator() % 2 == 0 ? "-" : "") + std::to_string(generator() >> (generator() % 64));
+        text += std::to_string(i) + "\t" + price + "\tname" + std::to_string(i) + "\t" + quantity + "\n";
+        expected[0].push_back(PrecisedFloat{std::string_view{quantity}});
+        expected[1].push_back(PrecisedFloat{std::string_view{price}});
+    }
+    const auto path = write_file("precised_float_chunks.tsv", text);
+    const std::vector<std::size_t> columns{3, 1};
+
+    for (const auto kernels : ALL_KERNELS) {
+        for (const auto threads_count : {1u, 4u}) {
+            std::vector<std::vector<PrecisedFloat>> results;
+            ASSERT_TRUE(read_csv_columns(path.c_str(), columns, results, '\t', false, threads_count, kernels));
+            ASSERT_EQ(results.size(), expected.size());
+            for (std::size_t slot = 0; slot < expected.size(); ++slot) {
+                ASSERT_EQ(results[slot].size(), expected[slot].size());
+                for (std::size_t i = 0; i < expected[slot].size(); ++i) {
+                    ASSERT_EQ(results[slot][i].str(), expected[slot][i].str()) << slot << " " << i;
+                }
+            }
+        }
+    }
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,104 @@
+#include "pch.h"
+#include "../precised_float_expressions.h"
+#include "test_helpers.h"
+
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using precised_float_expressions::lazy;
+
+namespace {
+    template<typename T>
+    concept starts_expression = requires(T&& p_float) { lazy(std::forward<T>(p_float)); };
+
+    // Expressions agree with the operators whenever those do not overflow, for numbers of both signs with mantissas
+    // below <max_mantissa> and up to 6 fraction digits
+    template<typename PFloat>
+    void check_agreement(const unsigned long long max_mantissa) {
+        const precised_float_tests::Shape shape{.max_mantissa = max_mantissa, .max_fraction_digits = 6, .nan_period = 0};
+        std::mt19937_64 generator{7};
+        for (auto i = 0; i < 20'000; ++i) {
+            const auto a = precised_float_tests::make_p_float<PFloat>(generator, shape);
+            const auto b = precised_float_tests::make_p_float<PFloat>(generator, shape);
+            const auto c = precised_float_tests::make_p_float<PFloat>(generator, shape);
+            const auto d = precised_float_tests::make_p_float<PFloat>(generator, shape);
+            const auto k = static_cast<int>(generator() % 201) - 100;
+
+            const auto check = [](const PFloat& expected, const PFloat& actual) {
+                if (!expected.is_nan()) {
+                    EXPECT_EQ(actual.str(), expected.str());
+                }
+            };
+            check((a + b) * c - d, (lazy(a) + b) * c - d);
+            check(a * b + c * d, lazy(a) * b + lazy(c) * d);
+            check(a - b - c + d, lazy(a) - b - c + d);
+            check(a * k + b - k, lazy(a) * k + b - k);
+            check(k - a * b, k - lazy(a) * b);
+        }
+    }
+}
+
+TEST(TestExpressions, TestAgreement) {
+    check_agreement<PrecisedFloat>(10'000'000'000ull);
+    check_agreement<PrecisedFloat32>(100'000ull);
+    check_agreement<PrecisedFloat128>(1'000'000'000'000'000'000ull);
+}
+
+TEST(TestExpressions, TestEvaluation) {
+    const PrecisedFloat a{std::string{"1.5"}};
+    const PrecisedFloat b{std::string{"2.25"}};
+    const PrecisedFloat c{2};
+    const PrecisedFloat d{std::string{"0.5"}};
+
+    const PrecisedFloat result = (lazy(a) + b) * c - d;
+    EXPECT_EQ(result.str(), "7.00");
+    EXPECT_EQ(((lazy(a) + b) * c - d).evaluate().str(), ((a + b) * c - d).str());
+    EXPECT_EQ(PrecisedFloat{lazy(a) * 0.5 + 1}.str(), (a * PrecisedFloat{0.5} + PrecisedFloat{1}).str());
+    EXPECT_EQ(PrecisedFloat{lazy(a) - a}.str(), (a - a).str());
+    EXPECT_EQ(PrecisedFloat{lazy(a) * -1 + a}.str(), "-0.0");
+
+    // Division is evaluated as it is written
+    EXPECT_EQ(PrecisedFloat{(lazy(a) + b) / c + d}.str(), ((a + b) / c + d).str());
+    EXPECT_EQ(PrecisedFloat{(lazy(a) + b) / PrecisedFloat{0}}.str(), "NaN");
+
+    EXPECT_EQ(PrecisedFloat{lazy(a) + PrecisedFloat{}}.str(), "NaN");
+
+    // Temporaries would not outlive the expression
+    static_assert(starts_expression<const PrecisedFloat&>);
+    static_assert(starts_expression<PrecisedFloat&>);
+    static_assert(!starts_expression<PrecisedFloat>);
+    static_assert(!starts_expression<PrecisedFloat32&&>);
+
+    // Temporary operands are kept by value, the expression outlives the product
+    using reference_t = precised_float_expressions::Reference<PrecisedFloat::mantissa_t, PrecisedFloat::magnitude_t>;
+    using value_t = precised_float_expressions::Value<PrecisedFloat::mantissa_t, PrecisedFloat::magnitude_t>;
+    static_assert(std::is_same_v<decltype(lazy(c) + a * b), precised_float_expressions::Sum<reference_t, value_t, false>>);
+    static_assert(std::is_same_v<decltype(a * b - lazy(c)), precised_float_expressions::Sum<value_t, reference_t, true>>);
+    static_assert(std::is_same_v<decltype(lazy(c) * a), precised_float_expressions::Product<reference_t, reference_t>>);
+
+    const auto expression = lazy(c) + a * b;
+    const PrecisedFloat stored = expression;
+    EXPECT_EQ(stored.str(), (c + a * b).str());
+}
+
+TEST(TestExpressions, TestIntermediateOverflow) {
+    const PrecisedFloat big{10'000'000'000};
+    const PrecisedFloat one{1};
+
+    // 10^20 does not fit into the mantissa but fits into the double width
+    EXPECT_EQ((big * big - big * big + one).str(), "NaN");
+    EXPECT_EQ(PrecisedFloat{lazy(big) * big - lazy(big) * big + one}.str(), "1.0");
+
+    // A double-width factor times one which fits into the mantissa
+    const PrecisedFloat max{std::string{"18446744073709551615"}};
+    EXPECT_EQ(PrecisedFloat{(lazy(max) + 1) * 1 - 1}.str(), max.str());
+    EXPECT_EQ(PrecisedFloat{lazy(big) * big * 3 - lazy(big) * big * 3 + one}.str(), "1.0");
+    EXPECT_EQ(PrecisedFloat{-3 * (lazy(big) * big) + lazy(big) * big * 3 - one}.str(), "-1.0");
+    EXPECT_EQ(PrecisedFloat{(lazy(big) * big) * (lazy(big) * big) - lazy(big) * big * big * big}.str(), "NaN");
+
+    EXPECT_EQ(PrecisedFloat{lazy(big) * big}.str(), "NaN");
+    EXPECT_EQ(PrecisedFloat{lazy(big) * big * big * big}.str(), "NaN");
+    EXPECT_EQ(PrecisedFloat{lazy(one) + PrecisedFloat{std::string{"0.00000000000000000001"}}}.str(), "NaN");
+}
@@ -0,0 +1,93 @@
+#include "pch.h"
+#include "../precised_float_formatting.h"
+#include "../precised_float_parsing.h"
+#include "test_helpers.h"
+
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using precised_float_tests::ALL_KERNELS;
+using precised_float_tests::make_p_floats;
+
+TEST(TestFormatBatch, TestLines) {
+    const std::vector<PrecisedFloat> p_floats{PrecisedFloat{std::string{"1.5"}}, PrecisedFloat{std::string{"-0.007"}}, PrecisedFloat{},
+                                              PrecisedFloat{std::string{"-0"}}, PrecisedFloat{std::string{"123456789012345678"}}};
+    const std::span<const PrecisedFloat> span{p_floats};
+
+    for (const auto kernels : ALL_KERNELS) {
+        EXPECT_EQ(format_batch(span, ',', 1, kernels), "1.5\n-0.007\nNaN\n-0.0\n123456789012345678.0\n");
+        EXPECT_EQ(format_batch(span, ';', 2, kernels), "1.5;-0.007\nNaN;-0.0\n123456789012345678.0\n");
+        EXPECT_EQ(format_batch(span, '\t', 0, kernels), "1.5\t-0.007\tNaN\t-0.0\t123456789012345678.0\n");
+        EXPECT_EQ(format_batch(span.first(0), ',', 1, kernels), "");
+    }
+
+    // Only whole lines go into a short buffer
+    char buffer[24];
+    const auto result = format_batch(span, std::begin(buffer), std::end(buffer), ',', 2);
+    EXPECT_EQ(result.count, 4u);
+    EXPECT_EQ(std::string(std::begin(buffer), result.ptr), "1.5,-0.007\nNaN,-0.0\n");
+    EXPECT_EQ(format_batch(span, std::begin(buffer), std::begin(buffer) + 5, ',', 2).count, 0u);
+}
+
+TEST(TestFormatBatch, TestLengths) {
+    // Numbers on both sides of the 16 characters the SIMD writers handle
+    const std::vector<std::pair<std::string, std::string>> cases{
+        {"123456789012.5",         "123456789012.5"},
+        {"-123456789012.5",        "-123456789012.5"},
+        {"1234567890123.45",       "1234567890123.45"},
+        {"-1234567890123.45",      "-1234567890123.45"},
+        {"12345678901234567",      "12345678901234567.0"},
+        {"18446744073709551615",   "18446744073709551615.0"},
+        {"-18446744073709551615",  "-18446744073709551615.0"},
+        {"0.000000000000000001",   "0.000000000000000001"},
+        {"-0.000000000000000001",  "-0.000000000000000001"},
+        {"-0.100000",              "-0.1"},
+        {"0.000",                  "0.0"},
+    };
+
+    std::vector<PrecisedFloat> p_floats;
+    std::string expected;
+    for (const auto& [text, formatted] : cases) {
+        p_floats.push_back(PrecisedFloat{text});
+        expected += formatted + "\n";
+    }
+
+    for (const auto kernels : ALL_KERNELS) {
+        EXPECT_EQ(format_batch(std::span<const PrecisedFloat>{p_floats}, ',', 1, kernels), expected);
+    }
+}
+
+TEST(TestFormatBatch, TestAgreementWithStr) {
+    // Mantissas of every length and magnitude orders on both sides of the SIMD writer limits, NaN and negative zeros
+    const auto p_floats = make_p_floats(10000, 5);
+    std::string expected;
+    for (std::size_t i = 0; i < p_floats.size(); ++i) {
+        expected += p_floats[i].str();
+        expected += i % 3 == 2 || i + 1 == p_floats.size() ? '\n' : ',';
+    }
+
+    for (const auto kernels : ALL_KERNELS) {
+        const auto text = format_batch(std::span<const PrecisedFloat>{p_floats}, ',', 3, kernels);
+        ASSERT_EQ(text, expected);
+
+        // Written in chunks through a small buffer
+        std::string chunks;
+        std::vector<char> buffer(100);
+        for (std::span<const PrecisedFloat> rest{p_floats}; !rest.empty();) {
+            const auto result = format_batch(rest, buffer.data(), buffer.data() + buffer.size(), ',', 3, kernels);
+            ASSERT_NE(result.count, 0u);
+            chunks.append(buffer.data(), result.ptr);
+            rest = rest.subspan(result.count);
+        }
+        ASSERT_EQ(chunks, expected);
+
+        // parse_batch() reads the text back as the string constructor reads str()
+        std::vector<PrecisedFloat> parsed;
+        ASSERT_EQ(parse_batch(text, parsed, ',', kernels), p_floats.size());
+        for (std::size_t i = 0; i < p_floats.size(); ++i) {
+            ASSERT_EQ(parsed[i].str(), PrecisedFloat{p_floats[i].str()}.str()) << i;
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#include "pch.h"
+#include "../precised_float_parsing.h"
+#include "test_helpers.h"
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using precised_float_tests::ALL_KERNELS;
+
+namespace {
+    // Well-formed numbers of every length around the 16 characters of the SIMD parser, trailing zeros and malformed fields
+    std::string make_field(std::mt19937_64& generator) {
+        constexpr std::string_view GARBAGE{"0123456789.-+ ex\r"};
+
+        std::string field;
+        switch (generator() % 6) {
+        case 0:
+            for (auto length = generator() % 8; length > 0; --length) {
+                field += GARBAGE[generator() % GARBAGE.size()];
+            }
+            break;
+        case 1:
+            field = std::to_string(generator() >> (generator() % 64)) + "." + std::string(generator() % 4, '0');
+            break;
+        default:
+            if (generator() % 2 == 0) {
+                field = "-";
+            }
+            field += std::to_string(generator() >> (generator() % 64));
+            if (generator() % 4 != 0) {
+                const auto fraction = std::to_string(generator() >> (generator() % 64));
+                field += "." + fraction.substr(0, generator() % (fraction.size() + 1)) + std::string(generator() % 3, '0');
+            }
+            break;
+        }
+
+        return field;
+    }
+}
+
+TEST(TestParseBatch, TestFields) {
+    std::vector<PrecisedFloat> p_floats;
+    EXPECT_EQ(parse_batch("1.50,-2,0.0\n-0,007.010\r\n99999999999999999999\n", p_floats), 6u);
+    ASSERT_EQ(p_floats.size(), 6u);
+    EXPECT_EQ(p_floats[0].str(), "1.5");
+    EXPECT_EQ(p_floats[1].str(), "-2.0");
+    EXPECT_EQ(p_floats[2].str(), "0.0");
+    EXPECT_EQ(p_floats[3].str(), "-0.0");
+    EXPECT_EQ(p_floats[4].str(), "7.01");
+    EXPECT_TRUE(p_floats[5].is_nan());
+
+    // Empty, malformed and too precise fields
+    p_floats.clear();
+    EXPECT_EQ(parse_batch("1,,.5,2.,+3,1.2.3,1e5,0.0000000000000000001", p_floats), 8u);
+    ASSERT_EQ(p_floats.size(), 8u);
+    EXPECT_EQ(p_floats[0].str(), "1.0");
+    for (std::size_t i = 1; i < p_floats.size(); ++i) {
+        EXPECT_TRUE(p_floats[i].is_nan()) << i;
+    }
+
+    p_floats.clear();
+    EXPECT_EQ(parse_batch("", p_floats), 0u);
+    EXPECT_EQ(parse_batch("\n", p_floats), 1u);
+    EXPECT_EQ(parse_batch("4\t-5.25\n", p_floats, '\t'), 2u);
+    ASSERT_EQ(p_floats.size(), 3u);
+    EXPECT_TRUE(p_floats[0].is_nan());
+    EXPECT_EQ(p_floats[2].str(), "-5.25");
+
+    // A separator at the end of the text is followed by an empty field, a line end is not
+    for (const auto kernels : ALL_KERNELS) {
+        p_floats.clear();
+        EXPECT_EQ(parse_batch("1,2,", p_floats, ',', kernels), 3u);
+        EXPECT_EQ(parse_batch("1,2,\n", p_floats, ',', kernels), 3u);
+        EXPECT_EQ(parse_batch("1,2\n", p_floats, ',', kernels), 2u);
+        ASSERT_EQ(p_floats.size(), 8u);
+        EXPECT_TRUE(p_floats[2].is_nan());
+        EXPECT_TRUE(p_floats[5].is_nan());
+        EXPECT_EQ(p_floats[7].str(), "2.0");
+    }
+
+    // Fields of 16 bytes, parsed in pairs by the AVX2 kernels, next to longer ones
+    for (const auto kernels : ALL_KERNELS) {
+        p_floats.clear();
+        EXPECT_EQ(parse_batch("1234567890123456,-123456789012345,-0.0000000000000,12345678901234.5,123456789012345.,"
+                              "0.00000000000001,12345678901234567,-1.5", p_floats, ',', kernels), 8u);
+        ASSERT_EQ(p_floats.size(), 8u);
+        EXPECT_EQ(p_floats[0].str(), "1234567890123456.0");
+        EXPECT_EQ(p_floats[1].str(), "-123456789012345.0");
+        EXPECT_EQ(p_floats[2].str(), "-0.0");
+        EXPECT_EQ(p_floats[3].str(), "12345678901234.5");
+        EXPECT_TRUE(p_floats[4].is_nan());
+        EXPECT_EQ(p_floats[5].str(), "0.00000000000001");
+        EXPECT_EQ(p_floats[6].str(), "12345678901234567.0");
+        EXPECT_EQ(p_floats[7].str(), "-1.5");
+    }
+
+    PrecisedFloatColumn column;
+    EXPECT_EQ(parse_batch("1.25\n-3\n", column), 2u);
+    ASSERT_EQ(column.size(), 2u);
+    EXPECT_EQ(column[0].str(), "1.25");
+    EXPECT_EQ(column[1].str(), "-3.0");
+
+    std::vector<PrecisedFloat32> p_floats_32;
+    EXPECT_EQ(parse_batch("1.5,4294967296,-0.001", p_floats_32), 3u);
+    EXPECT_EQ(p_floats_32[0].str(), "1.5");
+    EXPECT_TRUE(p_floats_32[1].is_nan());
+    EXPECT_EQ(p_floats_32[2].str(), "-0.001");
+}
+
+TEST(TestParseBatch, TestAgreementWithConstructor) {
+    std::mt19937_64 generator{11};
+    for (auto repetition = 0; repetition < 20; ++repetition) {
+        std::string text;
+        std::string field;
+        std::vector<PrecisedFloat> expected;
+        for (auto i = 0; i < 1000; ++i) {
+            field = make_field(generator);
+            auto number = std::string_view{field};
+            if (!number.empty() && number.back() == '\r') {
+                number.remove_suffix(1);
+            }
+            expected.push_back(PrecisedFloat{number});
+            text += field;
+            text += generator() % 2 == 0 ? ',' : '\n';
+        }
+        // Without the last separator a non-empty last field ends with the text
+        if (repetition % 2 == 0 && !field.empty()) {
+            text.pop_back();
+        } else if (text.back() == ',') {
+            expected.emplace_back();
+        }
+
+        for (const auto kernels : ALL_KERNELS) {
+            std::vector<PrecisedFloat> p_floats;
+            ASSERT_EQ(parse_batch(text, p_floats, ',', kernels), expected.size());
+            for (std::size_t i = 0; i < expected.size(); ++i) {
+                ASSERT_EQ(p_floats[i].str(), expected[i].str()) << i;
+            }
+        }
+    }
+}
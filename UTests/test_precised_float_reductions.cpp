@@ -0,0 +1,104 @@
+#include "pch.h"
+#include "../precised_float_reductions.h"
+#include "test_helpers.h"
+
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+    // Enough numbers for several chunks, with mixed signs and magnitude orders. Sums at the biggest magnitude order
+    // do not fit into the mantissa
+    std::vector<PrecisedFloat> make_p_floats(const std::size_t count, const unsigned seed) {
+        return precised_float_tests::make_p_floats(count, seed, {.max_mantissa = 10'000'000'000'000, .max_fraction_digits = 7, .nan_period = 0});
+    }
+
+    const std::vector<unsigned> THREADS_COUNTS{1, 2, 3, 7, 64, 0};
+}
+
+TEST(TestReductions, TestSum) {
+    const auto p_floats = make_p_floats(100'003, 1);
+    const std::span<const PrecisedFloat> span{p_floats};
+
+    PrecisedFloat::Accumulator accumulator;
+    accumulator.add(span);
+    const auto expected = accumulator.result();
+    EXPECT_FALSE(expected.is_nan());
+
+    for (const auto threads_count : THREADS_COUNTS) {
+        EXPECT_EQ(reduce_sum(span, threads_count).str(), expected.str()) << threads_count;
+        EXPECT_EQ(mean(span, threads_count).str(), (expected / PrecisedFloat{span.size()}).str()) << threads_count;
+    }
+
+    EXPECT_EQ(reduce_sum(span.first(0)).str(), "0.0");
+    EXPECT_EQ(mean(span.first(0)).str(), "NaN");
+
+    const std::vector<PrecisedFloat> small{PrecisedFloat{std::string{"1.5"}}, PrecisedFloat{std::string{"-0.25"}}, PrecisedFloat{2}};
+    EXPECT_EQ(reduce_sum(std::span<const PrecisedFloat>{small}).str(), "3.25");
+    EXPECT_EQ(mean(std::span<const PrecisedFloat>{small}).str(), "1.083333333333333333");
+
+    auto with_nan = p_floats;
+    with_nan[77'777] = PrecisedFloat{};
+    EXPECT_EQ(reduce_sum(std::span<const PrecisedFloat>{with_nan}, 4).str(), "NaN");
+}
+
+TEST(TestReductions, TestMinMax) {
+    auto p_floats = make_p_floats(100'003, 2);
+
+    // Equal numbers in other representations tell which of them is found
+    p_floats[50'000] = PrecisedFloat{std::string{"-99999999999999999.99"}};
+    p_floats[90'000] = PrecisedFloat{std::string{"-99999999999999999.990"}};
+    p_floats[10'000] = PrecisedFloat{std::string{"99999999999999999.990"}};
+    p_floats[60'000] = PrecisedFloat{std::string{"99999999999999999.99"}};
+    const std::span<const PrecisedFloat> span{p_floats};
+
+    for (const auto threads_count : THREADS_COUNTS) {
+        const auto [min, max] = reduce_minmax(span, threads_count);
+        EXPECT_EQ(min.str(), "-99999999999999999.99") << threads_count;
+        EXPECT_EQ(max.str(), "99999999999999999.99") << threads_count;
+    }
+
+    const std::vector<PrecisedFloat> small{PrecisedFloat{std::string{"1.5"}}, PrecisedFloat{std::string{"-0.25"}}, PrecisedFloat{2},
+                                           PrecisedFloat{std::string{"-0.0"}}};
+    const auto [small_min, small_max] = reduce_minmax(std::span<const PrecisedFloat>{small});
+    EXPECT_EQ(small_min.str(), "-0.25");
+    EXPECT_EQ(small_max.str(), "2.0");
+
+    const auto [empty_min, empty_max] = reduce_minmax(span.first(0));
+    EXPECT_TRUE(empty_min.is_nan());
+    EXPECT_TRUE(empty_max.is_nan());
+
+    p_floats[99'999] = PrecisedFloat{};
+    const auto [nan_min, nan_max] = reduce_minmax(std::span<const PrecisedFloat>{p_floats}, 4);
+    EXPECT_TRUE(nan_min.is_nan());
+    EXPECT_TRUE(nan_max.is_nan());
+}
+
+TEST(TestReductions, TestDot) {
+    const auto lhs = make_p_floats(100'003, 3);
+    const auto rhs = make_p_floats(100'000, 4);
+
+    PrecisedFloat::Accumulator accumulator;
+    PrecisedFloat128::Accumulator wide_accumulator;
+    std::vector<PrecisedFloat128> wide_lhs;
+    std::vector<PrecisedFloat128> wide_rhs;
+    for (std::size_t i = 0; i < rhs.size(); ++i) {
+        accumulator.add_product(lhs[i], rhs[i]);
+        wide_accumulator.add(PrecisedFloat128{lhs[i]} * PrecisedFloat128{rhs[i]});
+        wide_lhs.push_back(lhs[i]);
+        wide_rhs.push_back(rhs[i]);
+    }
+    const auto expected = accumulator.result();
+    const auto wide_expected = wide_accumulator.result();
+
+    for (const auto threads_count : THREADS_COUNTS) {
+        EXPECT_EQ(dot(std::span<const PrecisedFloat>{lhs}, std::span<const PrecisedFloat>{rhs}, threads_count).str(), expected.str()) << threads_count;
+        EXPECT_EQ(dot(std::span<const PrecisedFloat128>{wide_lhs}, std::span<const PrecisedFloat128>{wide_rhs}, threads_count).str(), wide_expected.str()) << threads_count;
+    }
+
+    // Products which operator*= turns into NaN
+    const std::vector<PrecisedFloat> big{PrecisedFloat{std::string{"10000000000.5"}}, PrecisedFloat{std::string{"-10000000000"}}};
+    const std::vector<PrecisedFloat> factors{PrecisedFloat{std::string{"10000000000"}}, PrecisedFloat{std::string{"10000000000.0000001"}}};
+    EXPECT_TRUE((big[0] * factors[0]).is_nan());
+    EXPECT_EQ(dot(std::span<const PrecisedFloat>{big}, std::span<const PrecisedFloat>{factors}).str(), "4999999000.0");
+}
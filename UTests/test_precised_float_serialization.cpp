@@ -0,0 +1,126 @@
+#include "pch.h"
+#include "../precised_float_serialization.h"
+#include "test_helpers.h"
+
+#include <cstddef>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+using precised_float_tests::make_p_floats;
+
+namespace {
+    template<typename PFloat>
+    void expect_block_round_trip(const std::vector<PFloat>& p_floats) {
+        std::vector<std::byte> bytes(max_encoded_size<PFloat>(p_floats.size()));
+        const auto end = encode(std::span<const PFloat>{p_floats}, bytes.data(), bytes.data() + bytes.size());
+        ASSERT_NE(end, nullptr);
+
+        std::vector<PFloat> decoded(p_floats.size() + 1);
+        const auto result = decode(std::span<const std::byte>{bytes.data(), end}, std::span<PFloat>{decoded});
+        ASSERT_EQ(result.ptr, end);
+        ASSERT_EQ(result.count, p_floats.size());
+        for (std::size_t i = 0; i < p_floats.size(); ++i) {
+            ASSERT_EQ(decoded[i].str(), p_floats[i].str()) << i;
+        }
+    }
+}
+
+TEST(TestSerialization, TestNumbers) {
+    const PrecisedFloat tiny{std::string{"0.000000000000000001"}};
+    std::vector<std::pair<PrecisedFloat, std::vector<unsigned>>> cases{
+        {PrecisedFloat{}, {0xFF}},
+        {PrecisedFloat{std::string{"1.5"}}, {0x01, 15}},
+        {PrecisedFloat{std::string{"-0.0"}}, {0x80, 0}},
+        {PrecisedFloat{std::string{"-12.345"}}, {0x83, 0xB9, 0x60}},
+        {PrecisedFloat{std::string{"18446744073709551615"}}, {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01}},
+        {PrecisedFloat{std::string{"-0.000000000000000001"}}, {0x92, 1}},
+        // Products have more fraction digits than MAGNITUDE_ORDER_LIMIT
+        {PrecisedFloat{std::string{"0.0000000001"}} * PrecisedFloat{std::string{"0.0000000001"}}, {0x14, 1}},
+        {PrecisedFloat{std::string{"0.0000000001"}} * PrecisedFloat{std::string{"-0.000000000000000005"}}, {0x9C, 5}},
+        {tiny * tiny * tiny * tiny * tiny * tiny * tiny, {0x7E, 1}},
+        {tiny * tiny * tiny * tiny * tiny * tiny * -tiny, {0xFE, 1}},
+        {tiny * tiny * tiny * tiny * tiny * tiny * tiny * PrecisedFloat{std::string{"0.1"}}, {0x7F, 0xFE, 0x01, 1}},
+        {tiny * tiny * tiny * tiny * tiny * tiny * tiny * PrecisedFloat{std::string{"-0.1"}}, {0x7F, 0xFF, 0x01, 1}},
+        {tiny * tiny * tiny * tiny * tiny * tiny * tiny * tiny, {0x7F, 0xA0, 0x02, 1}},
+    };
+
+    for (const auto& [p_float, expected] : cases) {
+        std::byte bytes[max_encoded_size<PrecisedFloat>()];
+        const auto end = encode(p_float, std::begin(bytes), std::end(bytes));
+        ASSERT_NE(end, nullptr);
+        ASSERT_EQ(static_cast<std::size_t>(end - bytes), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(std::to_integer<unsigned>(bytes[i]), expected[i]) << p_float.str();
+        }
+
+        PrecisedFloat decoded{1};
+        EXPECT_EQ(decode(std::cbegin(bytes), static_cast<const std::byte*>(end), decoded), end);
+        EXPECT_EQ(decoded.str(), p_float.str());
+
+        // Short buffers and cut off numbers
+        EXPECT_EQ(encode(p_float, std::begin(bytes), end - 1), nullptr);
+        EXPECT_EQ(decode(std::cbegin(bytes), static_cast<const std::byte*>(end - 1), decoded), nullptr);
+    }
+
+    // Overlong mantissas, magnitude orders which do not fit into magnitude_t and scales above MAGNITUDE_ORDER_LIMIT
+    const std::byte overlong[]{std::byte{0x00}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF},
+                               std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0x02}};
+    const std::byte huge_order[]{std::byte{0x7F}, std::byte{0x80}, std::byte{0x80}, std::byte{0x08}, std::byte{0x01}};
+    const std::byte cut_order[]{std::byte{0x7F}, std::byte{0x80}};
+    const std::byte big_scale[]{std::byte{0x01}, std::byte{0x13}, std::byte{0x04}};
+    PrecisedFloat decoded;
+    EXPECT_EQ(decode(std::begin(overlong), std::end(overlong), decoded), nullptr);
+    EXPECT_EQ(decode(std::begin(huge_order), std::end(huge_order), decoded), nullptr);
+    EXPECT_EQ(decode(std::begin(cut_order), std::end(cut_order), decoded), nullptr);
+    std::vector<PrecisedFloat> block(1);
+    EXPECT_EQ(decode(std::span<const std::byte>{big_scale}, std::span<PrecisedFloat>{block}).ptr, nullptr);
+}
+
+TEST(TestSerialization, TestBlocks) {
+    expect_block_round_trip(make_p_floats<PrecisedFloat>(20000, 3));
+    expect_block_round_trip(make_p_floats<PrecisedFloat32>(2000, 5));
+    expect_block_round_trip(make_p_floats<PrecisedFloat128>(2000, 7));
+    expect_block_round_trip(std::vector<PrecisedFloat>{});
+    expect_block_round_trip(std::vector<PrecisedFloat>(3));
+    const auto product = PrecisedFloat{std::string{"0.0000000001"}} * PrecisedFloat{std::string{"0.0000000001"}};
+    expect_block_round_trip(std::vector<PrecisedFloat>{product, -product, product * product * product * product * product * product * product,
+                                                       PrecisedFloat{std::string{"1.5"}}, product * PrecisedFloat{3}});
+
+    // Prices take about a third of their text
+    std::vector<PrecisedFloat> prices;
+    std::string text;
+    std::mt19937_64 generator{11};
+    for (auto i = 0; i < 1000; ++i) {
+        prices.push_back(PrecisedFloat{std::string{"1234.56"}} + PrecisedFloat{std::to_string(generator() % 1000)} * PrecisedFloat{std::string{"0.01"}});
+        text += prices.back().str() + "\n";
+    }
+    std::vector<std::byte> bytes(max_encoded_size<PrecisedFloat>(prices.size()));
+    const auto end = encode(std::span<const PrecisedFloat>{prices}, bytes.data(), bytes.data() + bytes.size());
+    ASSERT_NE(end, nullptr);
+    EXPECT_LT(static_cast<std::size_t>(end - bytes.data()) * 3, text.size());
+    EXPECT_EQ(encode(std::span<const PrecisedFloat>{prices}, bytes.data(), end - 1), nullptr);
+
+    // Blocks follow each other, short outputs and cut off blocks are refused
+    const std::span<const PrecisedFloat> first_prices{prices.data(), 10};
+    const auto second = encode(first_prices, bytes.data(), bytes.data() + bytes.size());
+    const auto last = encode(std::span<const PrecisedFloat>{prices}.subspan(10), second, bytes.data() + bytes.size());
+    ASSERT_NE(last, nullptr);
+
+    std::vector<PrecisedFloat> decoded(prices.size());
+    const auto first_result = decode(std::span<const std::byte>{bytes.data(), last}, std::span<PrecisedFloat>{decoded});
+    ASSERT_EQ(first_result.ptr, second);
+    ASSERT_EQ(first_result.count, 10u);
+    const auto second_result = decode(std::span<const std::byte>{first_result.ptr, last}, std::span<PrecisedFloat>{decoded}.subspan(10));
+    ASSERT_EQ(second_result.ptr, last);
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+        ASSERT_EQ(decoded[i].str(), prices[i].str()) << i;
+    }
+
+    const auto short_output = decode(std::span<const std::byte>{second, last}, std::span<PrecisedFloat>{decoded}.first(5));
+    EXPECT_EQ(short_output.ptr, nullptr);
+    EXPECT_EQ(short_output.count, prices.size() - 10);
+    EXPECT_EQ(decode(std::span<const std::byte>{second, last - 1}, std::span<PrecisedFloat>{decoded}).ptr, nullptr);
+    EXPECT_EQ(decode(std::span<const std::byte>{}, std::span<PrecisedFloat>{decoded}).count, 0u);
+}
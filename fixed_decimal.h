@@ -0,0 +1,415 @@
+#ifndef __FIXED_DECIMAL_H__
+#define __FIXED_DECIMAL_H__
+
+
+#include "precised_float.h"
+
+#include <compare>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+
+// Decimal number with the scale fixed at compile time: the value is <mantissa> / 10^Scale.
+// Addition and subtraction are a single integer operation with an overflow check, multiplication
+// and division rescale by compile-time constants. Results which do not fit into <Mantissa>, division
+// by zero and NaN operands give NaN. NaN is unordered and equal to nothing, as in BasicPrecisedFloat.
+template<unsigned short Scale,
+         typename Mantissa = long long>
+class FixedDecimal {
+    static_assert(std::is_integral<Mantissa>::value && std::is_signed<Mantissa>::value, "Mantissa must be a signed integer type");
+    static_assert(Scale <= std::numeric_limits<Mantissa>::digits10, "Scale factor must fit into Mantissa");
+
+public:
+    using mantissa_t    = Mantissa;
+    using p_float_t     = BasicPrecisedFloat<std::make_unsigned_t<Mantissa>>;
+
+
+    template<typename T>
+    using enable_if_integer_t = precised_float_details::enable_if_integer_t<T>;
+
+
+    template<unsigned short, typename>
+    friend class FixedDecimal;
+
+
+    static constexpr unsigned short SCALE          = Scale;
+    static constexpr mantissa_t     SCALE_FACTOR   = [] {
+        mantissa_t factor = 1;
+        for (auto i = 0; i < Scale; ++i) {
+            factor *= 10;
+        }
+
+        return factor;
+    }();
+
+
+    constexpr FixedDecimal() = default;
+    template<typename T,
+             enable_if_integer_t<T> = true>
+    explicit constexpr FixedDecimal(const T integer) noexcept : mantissa{multiply_checked(SCALE_FACTOR, integer)} {};
+    template<typename PFloatMantissa, typename Magnitude>
+    explicit FixedDecimal(const BasicPrecisedFloat<PFloatMantissa, Magnitude>& p_float) noexcept;
+    // Rescaling to a smaller scale truncates towards zero
+    template<unsigned short OtherScale>
+    explicit constexpr FixedDecimal(const FixedDecimal<OtherScale, Mantissa>& other) noexcept;
+
+
+    static constexpr FixedDecimal from_raw(const mantissa_t mantissa) noexcept;
+    constexpr mantissa_t raw() const noexcept;
+
+
+    constexpr FixedDecimal& operator+=(const FixedDecimal& other) & noexcept;
+    constexpr FixedDecimal operator+(const FixedDecimal& other) const noexcept;
+    constexpr FixedDecimal& operator-=(const FixedDecimal& other) & noexcept;
+    constexpr FixedDecimal operator-(const FixedDecimal& other) const noexcept;
+    constexpr FixedDecimal operator-() const noexcept;
+
+
+    // Multiplication and division keep the scale of the left operand, the result is truncated towards zero
+    template<unsigned short OtherScale>
+    FixedDecimal& operator*=(const FixedDecimal<OtherScale, Mantissa>& other) & noexcept;
+    template<typename T,
+             enable_if_integer_t<T> = true>
+    constexpr FixedDecimal& operator*=(const T integer) & noexcept;
+    template<unsigned short OtherScale>
+    FixedDecimal& operator/=(const FixedDecimal<OtherScale, Mantissa>& other) & noexcept;
+
+
+    constexpr bool operator==(const FixedDecimal& other) const noexcept;
+    constexpr std::partial_ordering operator<=>(const FixedDecimal& other) const noexcept;
+
+
+    template<typename PFloatMantissa, typename Magnitude>
+    explicit operator BasicPrecisedFloat<PFloatMantissa, Magnitude>() const noexcept;
+
+
+    std::string str() const;
+
+
+    constexpr bool is_nan() const noexcept;
+
+private:
+    using unsigned_mantissa_t = std::make_unsigned_t<Mantissa>;
+
+
+    static constexpr mantissa_t NAN_MANTISSA = std::numeric_limits<mantissa_t>::min();
+
+
+    static constexpr unsigned_mantissa_t magnitude_of(const mantissa_t mantissa) noexcept;
+    // Applies the sign to <magnitude>, NaN if the result does not fit into <mantissa_t>
+    static constexpr mantissa_t signed_from(const unsigned_mantissa_t magnitude, const bool negative) noexcept;
+    // NaN if an operand is NaN or the result does not fit into <mantissa_t>
+    static constexpr mantissa_t add_checked(const mantissa_t lhs, const mantissa_t rhs) noexcept;
+    static constexpr mantissa_t subtract_checked(const mantissa_t lhs, const mantissa_t rhs) noexcept;
+    template<typename T>
+    static constexpr mantissa_t multiply_checked(const mantissa_t multiplicand, const T multiplier) noexcept;
+
+
+    mantissa_t mantissa = 0;
+};
+
+
+template<unsigned short Scale, typename Mantissa, unsigned short OtherScale>
+FixedDecimal<Scale, Mantissa> operator*(const FixedDecimal<Scale, Mantissa>& lhs, const FixedDecimal<OtherScale, Mantissa>& rhs) noexcept {
+    FixedDecimal<Scale, Mantissa> temp_fixed_decimal{lhs};
+    temp_fixed_decimal *= rhs;
+
+    return temp_fixed_decimal;
+}
+
+template<unsigned short Scale, typename Mantissa, typename T,
+         precised_float_details::enable_if_integer_t<T> = true>
+constexpr FixedDecimal<Scale, Mantissa> operator*(const FixedDecimal<Scale, Mantissa>& fixed_decimal, const T integer) noexcept {
+    FixedDecimal<Scale, Mantissa> temp_fixed_decimal{fixed_decimal};
+    temp_fixed_decimal *= integer;
+
+    return temp_fixed_decimal;
+}
+
+template<unsigned short Scale, typename Mantissa, typename T,
+         precised_float_details::enable_if_integer_t<T> = true>
+constexpr FixedDecimal<Scale, Mantissa> operator*(const T integer, const FixedDecimal<Scale, Mantissa>& fixed_decimal) noexcept {
+    return fixed_decimal * integer;
+}
+
+template<unsigned short Scale, typename Mantissa, unsigned short OtherScale>
+FixedDecimal<Scale, Mantissa> operator/(const FixedDecimal<Scale, Mantissa>& lhs, const FixedDecimal<OtherScale, Mantissa>& rhs) noexcept {
+    FixedDecimal<Scale, Mantissa> temp_fixed_decimal{lhs};
+    temp_fixed_decimal /= rhs;
+
+    return temp_fixed_decimal;
+}
+
+
+template<unsigned short Scale, typename Mantissa>
+template<typename PFloatMantissa, typename Magnitude>
+FixedDecimal<Scale, Mantissa>::FixedDecimal(const BasicPrecisedFloat<PFloatMantissa, Magnitude>& p_float) noexcept {
+    using other_p_float_t = BasicPrecisedFloat<PFloatMantissa, Magnitude>;
+
+    if (p_float.state == other_p_float_t::State::NaN) {
+        mantissa = NAN_MANTISSA;
+        return;
+    }
+
+    auto magnitude = p_float.mantissa;
+    if (p_float.magnitude_order <= Scale) {
+        if (!other_p_float_t::scale_up(magnitude, Scale - p_float.magnitude_order)) {
+            mantissa = NAN_MANTISSA;
+            return;
+        }
+    } else {
+        magnitude = other_p_float_t::scale_down(magnitude, p_float.magnitude_order - Scale);
+    }
+
+    if (magnitude > std::numeric_limits<unsigned_mantissa_t>::max()) {
+        mantissa = NAN_MANTISSA;
+        return;
+    }
+
+    mantissa = signed_from(static_cast<unsigned_mantissa_t>(magnitude), p_float.state == other_p_float_t::State::NEGATIVE);
+}
+
+template<unsigned short Scale, typename Mantissa>
+template<unsigned short OtherScale>
+constexpr FixedDecimal<Scale, Mantissa>::FixedDecimal(const FixedDecimal<OtherScale, Mantissa>& other) noexcept : mantissa{other.mantissa} {
+    if (other.is_nan()) {
+        return;
+    }
+
+    if constexpr (OtherScale < Scale) {
+        constexpr auto FACTOR = SCALE_FACTOR / FixedDecimal<OtherScale, Mantissa>::SCALE_FACTOR;
+        const auto magnitude = magnitude_of(mantissa);
+        mantissa = magnitude <= std::numeric_limits<mantissa_t>::max() / FACTOR ? mantissa * FACTOR : NAN_MANTISSA;
+    } else if constexpr (OtherScale > Scale) {
+        mantissa /= FixedDecimal<OtherScale, Mantissa>::SCALE_FACTOR / SCALE_FACTOR;
+    }
+}
+
+
+template<unsigned short Scale, typename Mantissa>
+constexpr FixedDecimal<Scale, Mantissa> FixedDecimal<Scale, Mantissa>::from_raw(const mantissa_t mantissa) noexcept {
+    FixedDecimal fixed_decimal;
+    fixed_decimal.mantissa = mantissa;
+
+    return fixed_decimal;
+}
+
+template<unsigned short Scale, typename Mantissa>
+constexpr typename FixedDecimal<Scale, Mantissa>::mantissa_t FixedDecimal<Scale, Mantissa>::raw() const noexcept {
+    return mantissa;
+}
+
+
+template<unsigned short Scale, typename Mantissa>
+constexpr FixedDecimal<Scale, Mantissa>& FixedDecimal<Scale, Mantissa>::operator+=(const FixedDecimal& other) & noexcept {
+    mantissa = add_checked(mantissa, other.mantissa);
+
+    return *this;
+}
+
+template<unsigned short Scale, typename Mantissa>
+constexpr FixedDecimal<Scale, Mantissa> FixedDecimal<Scale, Mantissa>::operator+(const FixedDecimal& other) const noexcept {
+    return from_raw(add_checked(mantissa, other.mantissa));
+}
+
+template<unsigned short Scale, typename Mantissa>
+constexpr FixedDecimal<Scale, Mantissa>& FixedDecimal<Scale, Mantissa>::operator-=(const FixedDecimal& other) & noexcept {
+    mantissa = subtract_checked(mantissa, other.mantissa);
+
+    return *this;
+}
+
+template<unsigned short Scale, typename Mantissa>
+constexpr FixedDecimal<Scale, Mantissa> FixedDecimal<Scale, Mantissa>::operator-(const FixedDecimal& other) const noexcept {
+    return from_raw(subtract_checked(mantissa, other.mantissa));
+}
+
+template<unsigned short Scale, typename Mantissa>
+constexpr FixedDecimal<Scale, Mantissa> FixedDecimal<Scale, Mantissa>::operator-() const noexcept {
+    return is_nan() ? *this : from_raw(-mantissa);
+}
+
+
+template<unsigned short Scale, typename Mantissa>
+template<unsigned short OtherScale>
+FixedDecimal<Scale, Mantissa>& FixedDecimal<Scale, Mantissa>::operator*=(const FixedDecimal<OtherScale, Mantissa>& other) & noexcept {
+    if (is_nan() || other.is_nan()) {
+        mantissa = NAN_MANTISSA;
+        return *this;
+    }
+
+    constexpr auto DIVISOR = static_cast<unsigned_mantissa_t>(FixedDecimal<OtherScale, Mantissa>::SCALE_FACTOR);
+
+    unsigned_mantissa_t high;
+    unsigned_mantissa_t low;
+    p_float_t::multiply_wide(magnitude_of(mantissa), magnitude_of(other.mantissa), high, low);
+
+    unsigned_mantissa_t magnitude;
+    if (high == 0) {
+        magnitude = low / DIVISOR;
+    } else if (high < DIVISOR) {
+        unsigned_mantissa_t remainder;
+        magnitude = p_float_t::divide_wide(high, low, DIVISOR, remainder);
+    } else {
+        mantissa = NAN_MANTISSA;
+        return *this;
+    }
+
+    mantissa = signed_from(magnitude, (mantissa < 0) != (other.mantissa < 0));
+
+    return *this;
+}
+
+template<unsigned short Scale, typename Mantissa>
+template<typename T,
+         precised_float_details::enable_if_integer_t<T>>
+constexpr FixedDecimal<Scale, Mantissa>& FixedDecimal<Scale, Mantissa>::operator*=(const T integer) & noexcept {
+    mantissa = is_nan() ? NAN_MANTISSA : multiply_checked(mantissa, integer);
+
+    return *this;
+}
+
+template<unsigned short Scale, typename Mantissa>
+template<unsigned short OtherScale>
+FixedDecimal<Scale, Mantissa>& FixedDecimal<Scale, Mantissa>::operator/=(const FixedDecimal<OtherScale, Mantissa>& other) & noexcept {
+    if (is_nan() || other.is_nan() || other.mantissa == 0) {
+        mantissa = NAN_MANTISSA;
+        return *this;
+    }
+
+    constexpr auto MULTIPLIER = static_cast<unsigned_mantissa_t>(FixedDecimal<OtherScale, Mantissa>::SCALE_FACTOR);
+
+    const auto divisor = magnitude_of(other.mantissa);
+
+    unsigned_mantissa_t high;
+    unsigned_mantissa_t low;
+    p_float_t::multiply_wide(magnitude_of(mantissa), MULTIPLIER, high, low);
+    if (high >= divisor) {
+        mantissa = NAN_MANTISSA;
+        return *this;
+    }
+
+    unsigned_mantissa_t remainder;
+    const auto magnitude = p_float_t::divide_wide(high, low, divisor, remainder);
+
+    mantissa = signed_from(magnitude, (mantissa < 0) != (other.mantissa < 0));
+
+    return *this;
+}
+
+
+template<unsigned short Scale, typename Mantissa>
+constexpr bool FixedDecimal<Scale, Mantissa>::operator==(const FixedDecimal& other) const noexcept {
+    return !is_nan() && mantissa == other.mantissa;
+}
+
+template<unsigned short Scale, typename Mantissa>
+constexpr std::partial_ordering FixedDecimal<Scale, Mantissa>::operator<=>(const FixedDecimal& other) const noexcept {
+    if (is_nan() || other.is_nan()) {
+        return std::partial_ordering::unordered;
+    }
+
+    return mantissa <=> other.mantissa;
+}
+
+
+template<unsigned short Scale, typename Mantissa>
+template<typename PFloatMantissa, typename Magnitude>
+FixedDecimal<Scale, Mantissa>::operator BasicPrecisedFloat<PFloatMantissa, Magnitude>() const noexcept {
+    using other_p_float_t = BasicPrecisedFloat<PFloatMantissa, Magnitude>;
+
+    if (is_nan()) {
+        return other_p_float_t{};
+    }
+
+    const auto magnitude = magnitude_of(mantissa);
+    if (magnitude > other_p_float_t::MANTISSA_MAX) {
+        return other_p_float_t{};
+    }
+
+    other_p_float_t p_float{mantissa < 0 ? other_p_float_t::State::NEGATIVE : other_p_float_t::State::POSITIVE,
+                            static_cast<typename other_p_float_t::magnitude_t>(magnitude == 0 ? 0 : Scale),
+                            static_cast<typename other_p_float_t::mantissa_t>(magnitude)};
+    p_float.remove_trailing_zeros();
+
+    return p_float;
+}
+
+
+template<unsigned short Scale, typename Mantissa>
+std::string FixedDecimal<Scale, Mantissa>::str() const {
+    return static_cast<p_float_t>(*this).str();
+}
+
+
+template<unsigned short Scale, typename Mantissa>
+constexpr bool FixedDecimal<Scale, Mantissa>::is_nan() const noexcept {
+    return mantissa == NAN_MANTISSA;
+}
+
+
+template<unsigned short Scale, typename Mantissa>
+constexpr typename FixedDecimal<Scale, Mantissa>::unsigned_mantissa_t FixedDecimal<Scale, Mantissa>::magnitude_of(const mantissa_t mantissa) noexcept {
+    return mantissa < 0 ? unsigned_mantissa_t{0} - static_cast<unsigned_mantissa_t>(mantissa) : static_cast<unsigned_mantissa_t>(mantissa);
+}
+
+template<unsigned short Scale, typename Mantissa>
+constexpr typename FixedDecimal<Scale, Mantissa>::mantissa_t FixedDecimal<Scale, Mantissa>::signed_from(const unsigned_mantissa_t magnitude, const bool negative) noexcept {
+    if (magnitude > static_cast<unsigned_mantissa_t>(std::numeric_limits<mantissa_t>::max())) {
+        return NAN_MANTISSA;
+    }
+
+    return negative ? -static_cast<mantissa_t>(magnitude) : static_cast<mantissa_t>(magnitude);
+}
+
+// NaN is the smallest mantissa, so an operand which is NaN needs its own check next to the overflow flag
+template<unsigned short Scale, typename Mantissa>
+constexpr typename FixedDecimal<Scale, Mantissa>::mantissa_t FixedDecimal<Scale, Mantissa>::add_checked(const mantissa_t lhs, const mantissa_t rhs) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    mantissa_t sum;
+    const bool is_overflow = __builtin_add_overflow(lhs, rhs, &sum);
+#else
+    const auto sum = static_cast<mantissa_t>(static_cast<unsigned_mantissa_t>(lhs) + static_cast<unsigned_mantissa_t>(rhs));
+    const bool is_overflow = ((lhs ^ sum) & (rhs ^ sum)) < 0;
+#endif
+    return is_overflow || lhs == NAN_MANTISSA || rhs == NAN_MANTISSA ? NAN_MANTISSA : sum;
+}
+
+template<unsigned short Scale, typename Mantissa>
+constexpr typename FixedDecimal<Scale, Mantissa>::mantissa_t FixedDecimal<Scale, Mantissa>::subtract_checked(const mantissa_t lhs, const mantissa_t rhs) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    mantissa_t difference;
+    const bool is_overflow = __builtin_sub_overflow(lhs, rhs, &difference);
+#else
+    const auto difference = static_cast<mantissa_t>(static_cast<unsigned_mantissa_t>(lhs) - static_cast<unsigned_mantissa_t>(rhs));
+    const bool is_overflow = ((lhs ^ rhs) & (lhs ^ difference)) < 0;
+#endif
+    return is_overflow || lhs == NAN_MANTISSA || rhs == NAN_MANTISSA ? NAN_MANTISSA : difference;
+}
+
+template<unsigned short Scale, typename Mantissa>
+template<typename T>
+constexpr typename FixedDecimal<Scale, Mantissa>::mantissa_t FixedDecimal<Scale, Mantissa>::multiply_checked(const mantissa_t multiplicand, const T multiplier) noexcept {
+    using unsigned_t = std::make_unsigned_t<T>;
+
+    bool is_negative_multiplier = false;
+    auto multiplier_magnitude = static_cast<unsigned_t>(multiplier);
+    if constexpr (std::is_signed<T>::value) {
+        is_negative_multiplier = multiplier < 0;
+        multiplier_magnitude = is_negative_multiplier ? unsigned_t{0} - multiplier_magnitude : multiplier_magnitude;
+    }
+    if constexpr (sizeof(T) > sizeof(unsigned_mantissa_t)) {
+        if (multiplier_magnitude > std::numeric_limits<unsigned_mantissa_t>::max()) {
+            return multiplicand == 0 ? 0 : NAN_MANTISSA;
+        }
+    }
+
+    unsigned_mantissa_t high;
+    unsigned_mantissa_t low;
+    p_float_t::multiply_wide(magnitude_of(multiplicand), static_cast<unsigned_mantissa_t>(multiplier_magnitude), high, low);
+
+    return high != 0 ? NAN_MANTISSA : signed_from(low, (multiplicand < 0) != is_negative_multiplier);
+}
+
+#endif // __FIXED_DECIMAL_H__
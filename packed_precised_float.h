@@ -0,0 +1,160 @@
+#ifndef __PACKED_PRECISED_FLOAT_H__
+#define __PACKED_PRECISED_FLOAT_H__
+
+
+#include "precised_float.h"
+
+#include <bit>
+#include <string>
+
+
+// BasicPrecisedFloat in a single <Mantissa> word for dense storage: the sign bit, the magnitude order
+// and a mantissa shortened by the bits they take. The magnitude order field with all bits set is NaN.
+// Numbers convert without loss when they fit, possibly after their trailing fraction zeros are dropped,
+// and convert to NaN otherwise. try_pack() tells which of the two happened
+template<typename Mantissa,
+         typename Magnitude = unsigned short>
+class BasicPackedPrecisedFloat {
+public:
+    using p_float_t     = BasicPrecisedFloat<Mantissa, Magnitude>;
+    using bits_t        = Mantissa;
+    using mantissa_t    = Mantissa;
+    using magnitude_t   = Magnitude;
+
+
+    static constexpr int         MAGNITUDE_ORDER_BITS   = std::bit_width(static_cast<unsigned>(p_float_t::MAGNITUDE_ORDER_LIMIT));
+    static constexpr int         MANTISSA_BITS          = p_float_t::MANTISSA_DIGITS - 1 - MAGNITUDE_ORDER_BITS;
+    static constexpr magnitude_t MAGNITUDE_ORDER_MAX    = (1 << MAGNITUDE_ORDER_BITS) - 2;
+    static constexpr mantissa_t  MANTISSA_MAX           = (mantissa_t{1} << MANTISSA_BITS) - 1;
+
+
+    constexpr BasicPackedPrecisedFloat() = default;
+    explicit BasicPackedPrecisedFloat(const p_float_t& p_float) noexcept;
+
+
+    // Packs <p_float> into <packed>, false with <packed> set to NaN when it does not convert without loss
+    static bool try_pack(const p_float_t& p_float, BasicPackedPrecisedFloat& packed) noexcept;
+    // True when <p_float> converts without loss, NaN included
+    static bool fits(const p_float_t& p_float) noexcept;
+
+
+    static constexpr BasicPackedPrecisedFloat from_raw(const bits_t bits) noexcept;
+    constexpr bits_t raw() const noexcept;
+
+
+    explicit operator p_float_t() const noexcept;
+
+
+    std::string str() const;
+
+
+    constexpr bool is_nan() const noexcept;
+
+private:
+    static constexpr int    SIGN_SHIFT  = p_float_t::MANTISSA_DIGITS - 1;
+    static constexpr bits_t NAN_BITS    = bits_t{(1u << MAGNITUDE_ORDER_BITS) - 1} << MANTISSA_BITS;
+
+
+    // <p_float> without the trailing fraction zeros when it does not fit as it is
+    static p_float_t fitting(const p_float_t& p_float) noexcept;
+    static bool fits_as_is(const p_float_t& p_float) noexcept;
+
+
+    bits_t bits = NAN_BITS;
+};
+
+
+using PackedPrecisedFloat   = BasicPackedPrecisedFloat<unsigned long long>;
+using PackedPrecisedFloat32 = BasicPackedPrecisedFloat<std::uint32_t>;
+
+static_assert(sizeof(PackedPrecisedFloat) == sizeof(unsigned long long), "PackedPrecisedFloat must take 8 bytes");
+
+
+template<typename Mantissa, typename Magnitude>
+BasicPackedPrecisedFloat<Mantissa, Magnitude>::BasicPackedPrecisedFloat(const p_float_t& p_float) noexcept {
+    try_pack(p_float, *this);
+}
+
+
+template<typename Mantissa, typename Magnitude>
+bool BasicPackedPrecisedFloat<Mantissa, Magnitude>::try_pack(const p_float_t& p_float, BasicPackedPrecisedFloat& packed) noexcept {
+    packed.bits = NAN_BITS;
+    if (p_float.state == p_float_t::State::NaN) {
+        return true;
+    }
+
+    const auto packed_p_float = fitting(p_float);
+    if (!fits_as_is(packed_p_float)) {
+        return false;
+    }
+
+    packed.bits = static_cast<bits_t>(packed_p_float.state == p_float_t::State::NEGATIVE ? 1 : 0) << SIGN_SHIFT |
+                  static_cast<bits_t>(packed_p_float.magnitude_order) << MANTISSA_BITS |
+                  packed_p_float.mantissa;
+
+    return true;
+}
+
+template<typename Mantissa, typename Magnitude>
+bool BasicPackedPrecisedFloat<Mantissa, Magnitude>::fits(const p_float_t& p_float) noexcept {
+    BasicPackedPrecisedFloat packed;
+    return try_pack(p_float, packed);
+}
+
+
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPackedPrecisedFloat<Mantissa, Magnitude> BasicPackedPrecisedFloat<Mantissa, Magnitude>::from_raw(const bits_t bits) noexcept {
+    BasicPackedPrecisedFloat packed_p_float;
+    packed_p_float.bits = bits;
+
+    return packed_p_float;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr typename BasicPackedPrecisedFloat<Mantissa, Magnitude>::bits_t BasicPackedPrecisedFloat<Mantissa, Magnitude>::raw() const noexcept {
+    return bits;
+}
+
+
+template<typename Mantissa, typename Magnitude>
+BasicPackedPrecisedFloat<Mantissa, Magnitude>::operator p_float_t() const noexcept {
+    if (is_nan()) {
+        return p_float_t{};
+    }
+
+    return p_float_t{(bits >> SIGN_SHIFT) != 0 ? p_float_t::State::NEGATIVE : p_float_t::State::POSITIVE,
+                     static_cast<magnitude_t>((bits & NAN_BITS) >> MANTISSA_BITS),
+                     bits & MANTISSA_MAX};
+}
+
+
+template<typename Mantissa, typename Magnitude>
+std::string BasicPackedPrecisedFloat<Mantissa, Magnitude>::str() const {
+    return static_cast<p_float_t>(*this).str();
+}
+
+
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPackedPrecisedFloat<Mantissa, Magnitude>::is_nan() const noexcept {
+    return (bits & NAN_BITS) == NAN_BITS;
+}
+
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPackedPrecisedFloat<Mantissa, Magnitude>::p_float_t BasicPackedPrecisedFloat<Mantissa, Magnitude>::fitting(const p_float_t& p_float) noexcept {
+    if (fits_as_is(p_float)) {
+        return p_float;
+    }
+
+    auto shortened_p_float = p_float;
+    shortened_p_float.remove_trailing_zeros();
+
+    return shortened_p_float;
+}
+
+template<typename Mantissa, typename Magnitude>
+bool BasicPackedPrecisedFloat<Mantissa, Magnitude>::fits_as_is(const p_float_t& p_float) noexcept {
+    return p_float.state != p_float_t::State::NaN && p_float.mantissa <= MANTISSA_MAX && p_float.magnitude_order <= MAGNITUDE_ORDER_MAX;
+}
+
+#endif // __PACKED_PRECISED_FLOAT_H__
@@ -2,170 +2,419 @@
 #define __PRECISED_FLOAT_H__
 
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <climits>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <limits>
+#include <ostream>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <cmath>
 
-
-class PrecisedFloat {
-public:
-    using mantissa_t    = unsigned long long;
-    using magnitude_t   = unsigned short;
-    using precision_t   = unsigned short;
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 
+namespace precised_float_details {
     template<typename T>
     using enable_if_arithmetic_t = typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, bool>::type;
     template<typename T>
     using enable_if_integer_t = typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool>::type;
     template<typename T>
     using enable_if_floating_point_t = typename std::enable_if<std::is_floating_point<T>::value, bool>::type;
+    template<typename T, typename U>
+    using enable_if_different_t = typename std::enable_if<!std::is_same<T, U>::value, bool>::type;
+
+    template<typename Mantissa, typename Magnitude>
+    struct ExpressionTerm;
+    template<typename Mantissa, typename Magnitude>
+    class BatchParser;
+    template<typename Mantissa, typename Magnitude>
+    class BatchFormatter;
+    template<typename Mantissa, typename Magnitude>
+    class BinaryCodec;
+} // namespace precised_float_details
+
+
+template<unsigned short Scale, typename Mantissa>
+class FixedDecimal;
+
+template<typename Mantissa, typename Magnitude>
+class BasicPrecisedFloatColumn;
+
+template<typename Mantissa, typename Magnitude>
+class BasicPackedPrecisedFloat;
 
+template<typename Mantissa, typename Magnitude>
+class BasicPrecisedFloatColumnFile;
 
-    friend class std::numeric_limits<PrecisedFloat>;
 
+template<typename Mantissa,
+         typename Magnitude = unsigned short>
+class BasicPrecisedFloat {
+    static_assert(static_cast<Mantissa>(-1) > Mantissa{0}, "Mantissa must be an unsigned integer type");
 
-    static constexpr magnitude_t MAGNITUDE_ORDER_LIMIT = std::numeric_limits<mantissa_t>::digits10 - 1;
+public:
+    using mantissa_t    = Mantissa;
+    using magnitude_t   = Magnitude;
+    using precision_t   = unsigned short;
 
 
-    PrecisedFloat() = default;
-    explicit PrecisedFloat(const std::string& string);
+    template<typename T>
+    using enable_if_arithmetic_t = precised_float_details::enable_if_arithmetic_t<T>;
+    template<typename T>
+    using enable_if_integer_t = precised_float_details::enable_if_integer_t<T>;
+    template<typename T>
+    using enable_if_floating_point_t = precised_float_details::enable_if_floating_point_t<T>;
+    template<typename T>
+    using enable_if_other_mantissa_t = precised_float_details::enable_if_different_t<T, Mantissa>;
+
+
+    friend class std::numeric_limits<BasicPrecisedFloat>;
+    friend struct std::hash<BasicPrecisedFloat>;
+    template<typename, typename>
+    friend class BasicPrecisedFloat;
+    template<unsigned short, typename>
+    friend class FixedDecimal;
+    template<typename, typename>
+    friend class BasicPrecisedFloatColumn;
+    template<typename, typename>
+    friend class BasicPackedPrecisedFloat;
+    template<typename, typename>
+    friend class BasicPrecisedFloatColumnFile;
+    template<typename, typename>
+    friend struct precised_float_details::ExpressionTerm;
+    template<typename, typename>
+    friend class precised_float_details::BatchParser;
+    template<typename, typename>
+    friend class precised_float_details::BatchFormatter;
+    template<typename, typename>
+    friend class precised_float_details::BinaryCodec;
+
+
+    // <mantissa_t> may be an extended integer type (unsigned __int128) which std::numeric_limits does not describe
+    static constexpr int         MANTISSA_DIGITS          = sizeof(mantissa_t) * CHAR_BIT;
+    static constexpr int         MANTISSA_DIGITS10        = MANTISSA_DIGITS * 643 / 2136;
+    static constexpr mantissa_t  MANTISSA_MAX             = static_cast<mantissa_t>(~mantissa_t{0});
+    static constexpr magnitude_t MAGNITUDE_ORDER_LIMIT    = MANTISSA_DIGITS10 - 1;
+    // to_chars() buffer size which fits any number with magnitude order up to MAGNITUDE_ORDER_LIMIT
+    static constexpr std::size_t MAX_CHARS                = /* minus */ 1 + MANTISSA_DIGITS10 + 1 + /* ".0" */ 2;
+
+
+    BasicPrecisedFloat() = default;
+    explicit constexpr BasicPrecisedFloat(const std::string_view string) noexcept;
     template<typename T,
              enable_if_arithmetic_t<T> = true>
-    explicit PrecisedFloat(const T number);
+    explicit constexpr BasicPrecisedFloat(const T number);
+    // Widening is implicit and lossless, narrowing results in NaN when the mantissa does not fit
+    template<typename OtherMantissa,
+             enable_if_other_mantissa_t<OtherMantissa> = true>
+    explicit(sizeof(OtherMantissa) > sizeof(Mantissa)) constexpr BasicPrecisedFloat(const BasicPrecisedFloat<OtherMantissa, Magnitude>& other) noexcept;
 
 
-    PrecisedFloat& operator=(const std::string& string) &;
+    constexpr BasicPrecisedFloat& operator=(const std::string_view string) & noexcept;
     template<typename T,
              enable_if_arithmetic_t<T> = true>
-    PrecisedFloat& operator=(const T number) &;
+    constexpr BasicPrecisedFloat& operator=(const T number) &;
 
 
-    PrecisedFloat& operator+=(const PrecisedFloat& other) & noexcept;
+    constexpr BasicPrecisedFloat& operator+=(const BasicPrecisedFloat& other) & noexcept;
     template<typename T,
              enable_if_arithmetic_t<T> = true>
-    PrecisedFloat& operator+=(const T number) & noexcept;
-    PrecisedFloat operator+(const PrecisedFloat& other) const noexcept;
-    template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend PrecisedFloat operator+(const PrecisedFloat& p_float, const T number) noexcept;
-    template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend PrecisedFloat operator+(const T number, const PrecisedFloat& p_float) noexcept;
+    constexpr BasicPrecisedFloat& operator+=(const T number) & noexcept;
+    constexpr BasicPrecisedFloat operator+(const BasicPrecisedFloat& other) const noexcept;
 
 
-    PrecisedFloat& operator-=(const PrecisedFloat& other) & noexcept;
+    constexpr BasicPrecisedFloat& operator-=(const BasicPrecisedFloat& other) & noexcept;
     template<typename T,
              enable_if_arithmetic_t<T> = true>
-    PrecisedFloat& operator-=(const T number) & noexcept;
-    PrecisedFloat operator-(const PrecisedFloat& other) const noexcept;
-    template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend PrecisedFloat operator-(const PrecisedFloat& p_float, const T number) noexcept;
-    template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend PrecisedFloat operator-(const T number, const PrecisedFloat& p_float) noexcept;
+    constexpr BasicPrecisedFloat& operator-=(const T number) & noexcept;
+    constexpr BasicPrecisedFloat operator-(const BasicPrecisedFloat& other) const noexcept;
+    constexpr BasicPrecisedFloat operator-() const noexcept;
 
 
-    PrecisedFloat& operator*=(const PrecisedFloat& other) & noexcept;
+    // NaN when the product of the mantissas does not fit into <mantissa_t>
+    constexpr BasicPrecisedFloat& operator*=(const BasicPrecisedFloat& other) & noexcept;
     template<typename T,
              enable_if_arithmetic_t<T> = true>
-    PrecisedFloat& operator*=(const T number) & noexcept;
-    PrecisedFloat operator*(const PrecisedFloat& other) const noexcept;
-    template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend PrecisedFloat operator*(const PrecisedFloat& p_float, const T number) noexcept;
-    template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend PrecisedFloat operator*(const T number, const PrecisedFloat& p_float) noexcept;
+    constexpr BasicPrecisedFloat& operator*=(const T number) & noexcept;
+    constexpr BasicPrecisedFloat operator*(const BasicPrecisedFloat& other) const noexcept;
 
 
-    PrecisedFloat& operator/=(const PrecisedFloat& other) & noexcept;
+    constexpr BasicPrecisedFloat& operator/=(const BasicPrecisedFloat& other) & noexcept;
     template<typename T,
              enable_if_arithmetic_t<T> = true>
-    PrecisedFloat& operator/=(const T number) & noexcept;
-    PrecisedFloat operator/(const PrecisedFloat& other) const noexcept;
+    constexpr BasicPrecisedFloat& operator/=(const T number) & noexcept;
+    constexpr BasicPrecisedFloat operator/(const BasicPrecisedFloat& other) const noexcept;
+
+
+    // Integer operands are added, multiplied and compared at the magnitude order of the number without a BasicPrecisedFloat
+    // of their own, the results are the same as with BasicPrecisedFloat{<number>}
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend PrecisedFloat operator/(const PrecisedFloat& p_float, const T number) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr BasicPrecisedFloat operator+(const BasicPrecisedFloat& p_float, const T number) noexcept {
+        BasicPrecisedFloat temp_p_float{p_float};
+        temp_p_float.add_integer(number, false, true);
+
+        return temp_p_float;
+    }
+
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend PrecisedFloat operator/(const T number, const PrecisedFloat& p_float) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr BasicPrecisedFloat operator+(const T number, const BasicPrecisedFloat& p_float) noexcept {
+        BasicPrecisedFloat temp_p_float{p_float};
+        temp_p_float.add_integer(number, false, true);
 
+        return temp_p_float;
+    }
 
-    bool operator==(const PrecisedFloat& other) const noexcept;
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator==(const PrecisedFloat& p_float, const T number) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr BasicPrecisedFloat operator-(const BasicPrecisedFloat& p_float, const T number) noexcept {
+        BasicPrecisedFloat temp_p_float{p_float};
+        temp_p_float.add_integer(number, true, false);
+
+        return temp_p_float;
+    }
+
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator==(const T number, const PrecisedFloat& p_float) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr BasicPrecisedFloat operator-(const T number, const BasicPrecisedFloat& p_float) noexcept {
+        BasicPrecisedFloat temp_p_float{p_float};
+        temp_p_float.add_integer(number, true, true);
 
+        return temp_p_float;
+    }
 
-    bool operator!=(const PrecisedFloat& other) const noexcept;
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator!=(const PrecisedFloat& p_float, const T number) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr BasicPrecisedFloat operator*(const BasicPrecisedFloat& p_float, const T number) noexcept {
+        BasicPrecisedFloat temp_p_float{p_float};
+        temp_p_float.multiply_by_integer(number);
+
+        return temp_p_float;
+    }
+
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator!=(const T number, const PrecisedFloat& p_float) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr BasicPrecisedFloat operator*(const T number, const BasicPrecisedFloat& p_float) noexcept {
+        BasicPrecisedFloat temp_p_float{p_float};
+        temp_p_float.multiply_by_integer(number);
+
+        return temp_p_float;
+    }
 
+    template<typename T,
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator==(const BasicPrecisedFloat& p_float, const T number) noexcept {
+        return p_float.compare_with_integer(number) == 0;
+    }
 
-    bool operator<(const PrecisedFloat& other) const noexcept;
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator<(const PrecisedFloat& p_float, const T number) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator==(const T number, const BasicPrecisedFloat& p_float) noexcept {
+        return p_float.compare_with_integer(number) == 0;
+    }
+
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator<(const T number, const PrecisedFloat& p_float) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator!=(const BasicPrecisedFloat& p_float, const T number) noexcept {
+        return p_float.compare_with_integer(number) != 0;
+    }
 
+    template<typename T,
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator!=(const T number, const BasicPrecisedFloat& p_float) noexcept {
+        return p_float.compare_with_integer(number) != 0;
+    }
 
-    bool operator>(const PrecisedFloat& other) const noexcept;
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator>(const PrecisedFloat& p_float, const T number) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator<(const BasicPrecisedFloat& p_float, const T number) noexcept {
+        return p_float.compare_with_integer(number) < 0;
+    }
+
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator>(const T number, const PrecisedFloat& p_float) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator<(const T number, const BasicPrecisedFloat& p_float) noexcept {
+        return p_float.compare_with_integer(number) > 0;
+    }
 
+    template<typename T,
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator>(const BasicPrecisedFloat& p_float, const T number) noexcept {
+        return p_float.compare_with_integer(number) > 0;
+    }
 
-    bool operator<=(const PrecisedFloat& other) const noexcept;
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator<=(const PrecisedFloat& p_float, const T number) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator>(const T number, const BasicPrecisedFloat& p_float) noexcept {
+        return p_float.compare_with_integer(number) < 0;
+    }
+
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator<=(const T number, const PrecisedFloat& p_float) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator<=(const BasicPrecisedFloat& p_float, const T number) noexcept {
+        return p_float.compare_with_integer(number) <= 0;
+    }
 
+    template<typename T,
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator<=(const T number, const BasicPrecisedFloat& p_float) noexcept {
+        return p_float.compare_with_integer(number) >= 0;
+    }
 
-    bool operator>=(const PrecisedFloat& other) const noexcept;
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator>=(const PrecisedFloat& p_float, const T number) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator>=(const BasicPrecisedFloat& p_float, const T number) noexcept {
+        return p_float.compare_with_integer(number) >= 0;
+    }
+
     template<typename T,
-             enable_if_arithmetic_t<T>>
-    friend bool operator>=(const T number, const PrecisedFloat& p_float) noexcept;
+             enable_if_integer_t<T> = true>
+    friend constexpr bool operator>=(const T number, const BasicPrecisedFloat& p_float) noexcept {
+        return p_float.compare_with_integer(number) <= 0;
+    }
+
+
+    // Parses the longest prefix of [first, last) which looks like "-123.456", no allocations are made.
+    // On error <p_float> is left untouched, like with std::from_chars
+    friend constexpr std::from_chars_result from_chars(const char* first, const char* last, BasicPrecisedFloat& p_float) noexcept {
+        return p_float.parse(first, last);
+    }
+
+
+    class Divisor;
+
+    BasicPrecisedFloat& operator/=(const Divisor& divisor) & noexcept;
+
+    friend BasicPrecisedFloat operator/(const BasicPrecisedFloat& p_float, const Divisor& divisor) noexcept {
+        BasicPrecisedFloat temp_p_float{p_float};
+        temp_p_float /= divisor;
+
+        return temp_p_float;
+    }
+
+    friend void divide(std::span<BasicPrecisedFloat> p_floats, const Divisor& divisor) noexcept {
+        for (auto& p_float : p_floats) {
+            p_float /= divisor;
+        }
+    }
+
+
+    class Accumulator;
+
+
+    // <multiplicand> * <multiplier> + <addend> with one normalization and without the overflow of the product.
+    // It has the magnitude order of the same expression with operator* and operator+ when its mantissa fits,
+    // otherwise it is rounded as Accumulator::result()
+    friend BasicPrecisedFloat fma(const BasicPrecisedFloat& multiplicand, const BasicPrecisedFloat& multiplier, const BasicPrecisedFloat& addend) noexcept {
+        return fused_multiply_add(multiplicand, multiplier, addend);
+    }
+
+    // Computes min() of the span sizes results
+    friend void fma(std::span<const BasicPrecisedFloat> multiplicands, std::span<const BasicPrecisedFloat> multipliers,
+                    std::span<const BasicPrecisedFloat> addends, std::span<BasicPrecisedFloat> results) noexcept {
+        const auto count = std::min({multiplicands.size(), multipliers.size(), addends.size(), results.size()});
+        for (std::size_t i = 0; i < count; ++i) {
+            results[i] = fused_multiply_add(multiplicands[i], multipliers[i], addends[i]);
+        }
+    }
+
+
+    // Three-way comparison by value, NaN is unordered with everything including itself
+    constexpr std::partial_ordering compare(const BasicPrecisedFloat& other) const noexcept;
+    constexpr std::partial_ordering operator<=>(const BasicPrecisedFloat& other) const noexcept;
+
 
+    constexpr bool operator==(const BasicPrecisedFloat& other) const noexcept;
 
+
+    constexpr bool operator!=(const BasicPrecisedFloat& other) const noexcept;
+
+
+    constexpr bool operator<(const BasicPrecisedFloat& other) const noexcept;
+
+
+    constexpr bool operator>(const BasicPrecisedFloat& other) const noexcept;
+
+
+    constexpr bool operator<=(const BasicPrecisedFloat& other) const noexcept;
+
+
+    constexpr bool operator>=(const BasicPrecisedFloat& other) const noexcept;
+
+
+    // Sign class, exponent and significand packed big-endian: bytewise (memcmp) order of the keys
+    // is the numeric order, equal numbers have equal keys and NaN goes after everything
+    static constexpr std::size_t SORT_KEY_SIZE = (sizeof(magnitude_t) <= 2 ? 4 : 8) + sizeof(mantissa_t);
+    using sort_key_t = std::array<unsigned char, SORT_KEY_SIZE>;
+
+    sort_key_t sort_key() const noexcept;
+
+    // Stable LSD radix sort on sort_key()
+    friend void sort(std::span<BasicPrecisedFloat> p_floats) {
+        // Narrower indices keep the sorted entries smaller
+        if (p_floats.size() <= std::numeric_limits<std::uint32_t>::max()) {
+            radix_sort<std::uint32_t>(p_floats);
+        } else {
+            radix_sort<std::size_t>(p_floats);
+        }
+    }
+
+
+    // Correctly rounded for float and double, truncated toward zero for integers
     template<typename T,
              enable_if_arithmetic_t<T> = true>
     explicit operator T() const noexcept;
 
+    // Converts min(p_floats.size(), doubles.size()) numbers, the common case goes without branches
+    friend void to_double(std::span<const BasicPrecisedFloat> p_floats, std::span<double> doubles) noexcept {
+        convert_to_double(p_floats, doubles);
+    }
+
 
     std::string str() const noexcept;
+    // Writes the same characters as str() in their final positions, no allocations are made.
+    // Returns std::errc::value_too_large when [first, last) is too short, like std::to_chars
+    std::to_chars_result to_chars(char* first, char* last) const noexcept;
+
+    friend std::ostream& operator<<(std::ostream& stream, const BasicPrecisedFloat& p_float) {
+        char buffer[MAX_CHARS];
+        const auto [end, error] = p_float.to_chars(std::begin(buffer), std::end(buffer));
+        if (error != std::errc{}) {
+            return stream << p_float.str();
+        }
+
+        return stream.write(buffer, end - buffer);
+    }
+
 
+    constexpr BasicPrecisedFloat& precise(const precision_t precision = 6) noexcept;
+    constexpr BasicPrecisedFloat& round(const precision_t precision = 6) noexcept;
+    constexpr BasicPrecisedFloat& round_up(const precision_t precision = 6) noexcept;
+    constexpr BasicPrecisedFloat& round_down(const precision_t precision = 6) noexcept;
 
-    PrecisedFloat& precise(const precision_t precision = 6) noexcept;
-    PrecisedFloat& round(const precision_t precision = 6) noexcept;
-    PrecisedFloat& round_up(const precision_t precision = 6) noexcept;
-    PrecisedFloat& round_down(const precision_t precision = 6) noexcept;
 
+    // Brings the number to its canonical form: no trailing fraction zeros and positive zero,
+    // equal numbers have the same canonical form
+    constexpr BasicPrecisedFloat& normalize() noexcept;
 
-    bool is_nan() const noexcept;
+
+    constexpr bool is_nan() const noexcept;
 
 private:
-    enum class State {
+    enum class State : signed char {
         NaN = -1,
         NEGATIVE,
         POSITIVE
@@ -177,26 +426,176 @@ private:
     static constexpr char MINUS_CHAR    = '-';
 
 
-    explicit constexpr PrecisedFloat(const State state, const magnitude_t magnitude_order, const mantissa_t mantissa) : state{state},
-                                                                                                                        magnitude_order{magnitude_order},
-                                                                                                                        mantissa{mantissa}
-                                                                                                                        {};
+    // Double-width type for <mantissa_t> if the platform has one, void otherwise
+    using wide_mantissa_t = std::conditional_t<sizeof(mantissa_t) * 2 <= sizeof(unsigned long long), unsigned long long,
+#if defined(__SIZEOF_INT128__)
+                            std::conditional_t<sizeof(mantissa_t) * 2 <= sizeof(unsigned __int128), unsigned __int128, void>>;
+#else
+                            void>;
+#endif
+
+
+    static constexpr mantissa_t  RADIX                = 10;
+    static constexpr std::size_t RADIX_POWERS_COUNT   = MANTISSA_DIGITS10 + 1;
+
+    // RADIX_POWERS[n] == RADIX^n for every power which fits into <mantissa_t> type
+    static constexpr std::array<mantissa_t, RADIX_POWERS_COUNT> RADIX_POWERS = [] {
+        std::array<mantissa_t, RADIX_POWERS_COUNT> powers{};
+        mantissa_t power = 1;
+        for (auto& element : powers) {
+            element = power;
+            power *= RADIX;
+        }
+
+        return powers;
+    }();
+
+    // SCALE_UP_LIMITS[n] is the biggest mantissa which may be multiplied by RADIX_POWERS[n] without overflow
+    static constexpr std::array<mantissa_t, RADIX_POWERS_COUNT> SCALE_UP_LIMITS = [] {
+        std::array<mantissa_t, RADIX_POWERS_COUNT> limits{};
+        for (std::size_t i = 0; i < RADIX_POWERS_COUNT; ++i) {
+            limits[i] = MANTISSA_MAX / RADIX_POWERS[i];
+        }
+
+        return limits;
+    }();
+
+    // Descending powers of two below RADIX_POWERS_COUNT, trailing zeros are stripped by these steps
+    static constexpr auto TRAILING_ZEROS_STEPS = [] {
+        std::array<std::size_t, std::bit_width(RADIX_POWERS_COUNT - 1)> steps{};
+        std::size_t step = std::bit_floor(RADIX_POWERS_COUNT - 1);
+        for (auto& element : steps) {
+            element = step;
+            step /= 2;
+        }
+
+        return steps;
+    }();
+
+
+    // Significands of the powers of ten for binary to decimal conversion: 10^e * 2^(127 - floor(log2(10^e))) rounded
+    // down plus one, stored as {high, low} halves, for e from POW10_SIGNIFICANDS_MIN to POW10_SIGNIFICANDS_MAX
+    static constexpr int POW10_SIGNIFICANDS_MIN     = -40;
+    static constexpr int POW10_SIGNIFICANDS_MAX     = 60;
+    static constexpr auto POW10_SIGNIFICANDS = [] {
+        std::array<std::array<unsigned long long, 2>, POW10_SIGNIFICANDS_MAX - POW10_SIGNIFICANDS_MIN + 1> significands{};
+        for (int e = POW10_SIGNIFICANDS_MIN; e <= POW10_SIGNIFICANDS_MAX; ++e) {
+            // Exact arithmetic on 32-bit limbs, big enough for 10^60 and 2^(127 + 133)
+            std::array<std::uint32_t, 16> number{1};
+            const auto multiply = [&number](const std::uint32_t multiplier) {
+                std::uint64_t carry = 0;
+                for (auto& limb : number) {
+                    const auto product = std::uint64_t{limb} * multiplier + carry;
+                    limb = static_cast<std::uint32_t>(product);
+                    carry = product >> 32;
+                }
+            };
+            const auto divide = [&number](const std::uint32_t divisor) {
+                std::uint64_t remainder = 0;
+                for (auto i = number.size(); i-- > 0;) {
+                    const auto dividend = remainder << 32 | number[i];
+                    number[i] = static_cast<std::uint32_t>(dividend / divisor);
+                    remainder = dividend % divisor;
+                }
+            };
+
+            const int binary_exponent = e * 1741647 >> 19;
+            for (int i = 0; i < e; ++i) {
+                multiply(10);
+            }
+            for (int i = binary_exponent; i < 127; ++i) {
+                multiply(2);
+            }
+            for (int i = 127; i < binary_exponent; ++i) {
+                divide(2);
+            }
+            for (int i = e; i < 0; ++i) {
+                divide(10);
+            }
+
+            auto& significand = significands[e - POW10_SIGNIFICANDS_MIN];
+            significand[0] = static_cast<unsigned long long>(number[3]) << 32 | number[2];
+            significand[1] = (static_cast<unsigned long long>(number[1]) << 32 | number[0]) + 1;
+            if (significand[1] == 0) {
+                ++significand[0];
+            }
+        }
+
+        return significands;
+    }();
+
+
+    using sort_key_head_t = std::conditional_t<(sizeof(magnitude_t) <= 2), std::uint32_t, std::uint64_t>;
+
+
+    explicit constexpr BasicPrecisedFloat(const State state, const magnitude_t magnitude_order, const mantissa_t mantissa) : state{state},
+                                                                                                                             magnitude_order{magnitude_order},
+                                                                                                                             mantissa{mantissa}
+                                                                                                                             {};
 
 
-    void set_from(const std::string& string);
+    constexpr void set_from(const std::string_view string) noexcept;
     template<typename T,
              enable_if_integer_t<T> = true>
-    void set_from(const T integer) noexcept;
+    constexpr void set_from(const T integer) noexcept;
     template<typename T,
              enable_if_floating_point_t<T> = true>
     void set_from(const T floating_point) noexcept;
-    void make_addition(const PrecisedFloat& p_float) noexcept;
-    void make_subtraction(const PrecisedFloat& p_float) noexcept;
-    void switch_sign() noexcept;
-    void set_nan() noexcept;
+    // Shortest decimal <significand> * 10^<exponent> which reads back as the positive finite <floating_point>
+    // (R. Giulietti, "The Schubfach way to render doubles"), false if the exponent is out of POW10_SIGNIFICANDS
+    template<typename T>
+    static bool make_shortest_decimal(const T floating_point, unsigned long long& significand, int& exponent) noexcept;
+    constexpr std::from_chars_result parse(const char* first, const char* last) noexcept;
+    // Nearest float or double to <mantissa> / 10^<magnitude_order>: exact powers of ten (W. D. Clinger) when both operands
+    // are exact, a 64x128-bit product otherwise (D. Lemire, "Number Parsing at a Gigabyte per Second"),
+    // and exact big integer division when the power of ten is out of POW10_SIGNIFICANDS
+    template<typename T>
+    static T make_floating_point(const mantissa_t mantissa, const magnitude_t magnitude_order) noexcept;
+    template<typename T>
+    static T make_floating_point_exactly(const mantissa_t mantissa, const std::size_t magnitude_order) noexcept;
+    static void convert_to_double(std::span<const BasicPrecisedFloat> p_floats, std::span<double> doubles) noexcept;
+    static BasicPrecisedFloat fused_multiply_add(const BasicPrecisedFloat& multiplicand, const BasicPrecisedFloat& multiplier,
+                                                 const BasicPrecisedFloat& addend) noexcept;
+    // fused_multiply_add() of the terms which do not fit into double-width mantissas
+    static BasicPrecisedFloat fused_multiply_add_exactly(const BasicPrecisedFloat& multiplicand, const BasicPrecisedFloat& multiplier,
+                                                         const BasicPrecisedFloat& addend) noexcept;
+    constexpr void make_addition(const BasicPrecisedFloat& p_float) noexcept;
+    // *this + <integer>, or <integer> + *this when <is_integer_lhs>, and the same with subtraction.
+    // A zero result keeps the state of the left operand
+    template<typename T>
+    constexpr void add_integer(const T integer, const bool is_subtraction, const bool is_integer_lhs) noexcept;
+    template<typename T>
+    constexpr void multiply_by_integer(const T integer) noexcept;
+    template<typename T>
+    constexpr std::partial_ordering compare_with_integer(const T integer) const noexcept;
+    constexpr void make_subtraction(const BasicPrecisedFloat& p_float) noexcept;
+    constexpr void switch_sign() noexcept;
+    constexpr void set_nan() noexcept;
+    constexpr void remove_trailing_zeros() noexcept;
+    // sort_key() as two integers, the head holds the sign class, the exponent and the highest significand digit
+    void make_sort_key(sort_key_head_t& head, mantissa_t& tail) const noexcept;
 
 
-    int char_to_int(const char c) const noexcept;
+    // The magnitude of <integer>, false when it does not fit into <mantissa_t>
+    template<typename T>
+    static constexpr bool integer_to_mantissa(const T integer, mantissa_t& mantissa) noexcept;
+    static constexpr bool scale_up(mantissa_t& mantissa, const std::size_t shift) noexcept;
+    static constexpr mantissa_t scale_down(const mantissa_t mantissa, const std::size_t shift) noexcept;
+    static constexpr std::size_t count_digits(const mantissa_t mantissa) noexcept;
+    std::size_t count_chars() const noexcept;
+    static constexpr int count_leading_zeros(const mantissa_t mantissa) noexcept;
+    static constexpr std::size_t fraction_digits_after(const mantissa_t integer_part) noexcept;
+    static constexpr void multiply_wide(const mantissa_t multiplicand, const mantissa_t multiplier, mantissa_t& high, mantissa_t& low) noexcept;
+    // Divides the double-width number <high>:<low> by <divisor>, <high> must be less than <divisor>
+    static constexpr mantissa_t divide_wide(const mantissa_t high, const mantissa_t low, const mantissa_t divisor, mantissa_t& remainder) noexcept;
+    template<typename Index>
+    static void radix_sort(std::span<BasicPrecisedFloat> p_floats);
+    template<typename WideDivision>
+    constexpr void make_division(const mantissa_t divisor_mantissa, const magnitude_t divisor_magnitude_order, const WideDivision& wide_division) noexcept;
+
+
+    constexpr int char_to_int(const char c) const noexcept;
+    static constexpr bool is_digit(const char c) noexcept;
 
 
     State          state              = State::NaN;
@@ -205,18 +604,62 @@ private:
 };
 
 
+using PrecisedFloat     = BasicPrecisedFloat<unsigned long long>;
+using PrecisedFloat32   = BasicPrecisedFloat<std::uint32_t>;
+using PrecisedFloat64   = PrecisedFloat;
+#if defined(__SIZEOF_INT128__)
+using PrecisedFloat128  = BasicPrecisedFloat<unsigned __int128>;
+#endif
+
+
+// 0.0025_pf is PrecisedFloat{"0.0025"} evaluated at compile time, digit separators are skipped.
+// Literals which the string constructor does not accept (exponents, hexadecimal, too many digits) do not compile
+namespace precised_float_details {
+    // Not constexpr, so calling it from a consteval function makes the literal ill-formed
+    inline void unsupported_precised_float_literal() noexcept {}
+} // namespace precised_float_details
+
+namespace precised_float_literals {
+    template<char... Chars>
+    consteval PrecisedFloat operator""_pf() noexcept {
+        constexpr char DIGIT_SEPARATOR = '\'';
+
+        std::array<char, sizeof...(Chars)> chars{};
+        std::size_t length = 0;
+        for (const auto c : {Chars...}) {
+            if (c != DIGIT_SEPARATOR) {
+                chars[length++] = c;
+            }
+        }
+
+        const PrecisedFloat p_float{std::string_view{chars.data(), length}};
+        if (p_float.is_nan()) {
+            precised_float_details::unsupported_precised_float_literal();
+        }
+
+        return p_float;
+    }
+} // namespace precised_float_literals
+
+
 namespace std {
-    template<>
-    struct numeric_limits<PrecisedFloat> {
+    template<typename Mantissa, typename Magnitude>
+    struct numeric_limits<BasicPrecisedFloat<Mantissa, Magnitude>> {
+    private:
+        using p_float_t = BasicPrecisedFloat<Mantissa, Magnitude>;
+
+    public:
         static constexpr bool                  is_specialized       = true;
         static constexpr bool                  is_signed            = true;
         static constexpr bool                  is_integer           = false;
         static constexpr bool                  is_exact             = true;
         static constexpr int                   radix                = 10;
-        static constexpr int                   min_exponent         = -PrecisedFloat::MAGNITUDE_ORDER_LIMIT;
-        static constexpr int                   min_exponent10       = -PrecisedFloat::MAGNITUDE_ORDER_LIMIT;
-        static constexpr int                   max_exponent         = PrecisedFloat::MAGNITUDE_ORDER_LIMIT;
-        static constexpr int                   max_exponent10       = PrecisedFloat::MAGNITUDE_ORDER_LIMIT;
+        static constexpr int                   digits               = p_float_t::MANTISSA_DIGITS10;
+        static constexpr int                   digits10             = p_float_t::MANTISSA_DIGITS10;
+        static constexpr int                   min_exponent         = -p_float_t::MAGNITUDE_ORDER_LIMIT;
+        static constexpr int                   min_exponent10       = -p_float_t::MAGNITUDE_ORDER_LIMIT;
+        static constexpr int                   max_exponent         = p_float_t::MAGNITUDE_ORDER_LIMIT;
+        static constexpr int                   max_exponent10       = p_float_t::MAGNITUDE_ORDER_LIMIT;
         static constexpr bool                  has_infinity         = true;
         static constexpr bool                  has_quiet_NaN        = true;
         static constexpr bool                  has_signaling_NaN    = false;
@@ -230,74 +673,211 @@ namespace std {
         static constexpr float_round_style     round_style          = round_to_nearest;
 
 
-        static constexpr PrecisedFloat min() noexcept {
-            return PrecisedFloat{PrecisedFloat::State::POSITIVE, 0, 0};
+        static constexpr p_float_t min() noexcept {
+            return p_float_t{p_float_t::State::POSITIVE, 0, 0};
         }
 
-        static constexpr PrecisedFloat max() noexcept {
-            return PrecisedFloat{PrecisedFloat::State::POSITIVE, 0,
-                                 mantissa_upper_bound_max(PrecisedFloat::MAGNITUDE_ORDER_LIMIT) - 1};
+        static constexpr p_float_t max() noexcept {
+            return p_float_t{p_float_t::State::POSITIVE, 0,
+                             mantissa_upper_bound_max(p_float_t::MAGNITUDE_ORDER_LIMIT) - 1};
         }
 
-        static constexpr PrecisedFloat lowest() noexcept {
-            return PrecisedFloat{PrecisedFloat::State::NEGATIVE, 0,
-                                 mantissa_upper_bound_max(PrecisedFloat::MAGNITUDE_ORDER_LIMIT) - 1};
+        static constexpr p_float_t lowest() noexcept {
+            return p_float_t{p_float_t::State::NEGATIVE, 0,
+                             mantissa_upper_bound_max(p_float_t::MAGNITUDE_ORDER_LIMIT) - 1};
         }
 
-        static constexpr PrecisedFloat epsilon() noexcept {
-            return PrecisedFloat{PrecisedFloat::State::POSITIVE, 0, 0};
+        static constexpr p_float_t epsilon() noexcept {
+            return p_float_t{p_float_t::State::POSITIVE, 0, 0};
         }
 
-        static constexpr PrecisedFloat round_error() noexcept {
-            return PrecisedFloat{PrecisedFloat::State::POSITIVE, 0, 0};
+        static constexpr p_float_t round_error() noexcept {
+            return p_float_t{p_float_t::State::POSITIVE, 0, 0};
         }
 
-        static constexpr PrecisedFloat infinity() noexcept {
-            return PrecisedFloat{PrecisedFloat::State::POSITIVE,
-                                 std::numeric_limits<PrecisedFloat::magnitude_t>::max(),
-                                 std::numeric_limits<PrecisedFloat::mantissa_t>::max()};
+        static constexpr p_float_t infinity() noexcept {
+            return p_float_t{p_float_t::State::POSITIVE,
+                             std::numeric_limits<typename p_float_t::magnitude_t>::max(),
+                             p_float_t::MANTISSA_MAX};
         }
 
-        static constexpr PrecisedFloat quiet_NaN() noexcept {
+        static constexpr p_float_t quiet_NaN() noexcept {
             return {};
         }
 
     private:
-        static constexpr PrecisedFloat::mantissa_t mantissa_upper_bound_max(const std::size_t order_limit) {
-            return order_limit > 0 ? mantissa_upper_bound_max(order_limit - 1) * std::numeric_limits<PrecisedFloat>::radix
-                                   : std::numeric_limits<PrecisedFloat>::radix;
+        static constexpr typename p_float_t::mantissa_t mantissa_upper_bound_max(const std::size_t order_limit) {
+            return order_limit > 0 ? mantissa_upper_bound_max(order_limit - 1) * radix
+                                   : radix;
+        }
+    };
+
+
+    // Hashes the canonical form, so numbers equal by value have the same hash
+    template<typename Mantissa, typename Magnitude>
+    struct hash<BasicPrecisedFloat<Mantissa, Magnitude>> {
+    private:
+        using p_float_t = BasicPrecisedFloat<Mantissa, Magnitude>;
+
+    public:
+        size_t operator()(const p_float_t& p_float) const noexcept {
+            p_float_t canonical{p_float};
+            canonical.normalize();
+
+            uint64_t value = static_cast<uint64_t>(canonical.mantissa);
+            if constexpr (sizeof(typename p_float_t::mantissa_t) > sizeof(uint64_t)) {
+                value ^= static_cast<uint64_t>(canonical.mantissa >> 64) * 0x9E3779B97F4A7C15ull;
+            }
+            value += (static_cast<uint64_t>(canonical.magnitude_order) << 2 | static_cast<uint64_t>(static_cast<int>(canonical.state) + 1)) * 0xC2B2AE3D27D4EB4Full;
+
+            // MurmurHash3 finalizer
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCDull;
+            value ^= value >> 33;
+            value *= 0xC4CEB9FE1A85EC53ull;
+            value ^= value >> 33;
+
+            return static_cast<size_t>(value);
         }
     };
+
+
+    // Operations on different mantissa widths are carried out in the wider one
+    template<typename LhsMantissa, typename RhsMantissa, typename Magnitude>
+    struct common_type<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>> {
+        using type = BasicPrecisedFloat<conditional_t<(sizeof(LhsMantissa) >= sizeof(RhsMantissa)), LhsMantissa, RhsMantissa>, Magnitude>;
+    };
 } // namespace std
 
 
-PrecisedFloat::PrecisedFloat(const std::string& string) {
+// Divisor prepared for repeated division: every division by it costs a couple of multiplications
+// instead of a hardware division (N. Moller, T. Granlund, "Improved division by invariant integers")
+template<typename Mantissa, typename Magnitude>
+class BasicPrecisedFloat<Mantissa, Magnitude>::Divisor {
+public:
+    explicit Divisor(const BasicPrecisedFloat& p_float) noexcept;
+
+
+    mantissa_t divide_wide(const mantissa_t high, const mantissa_t low, mantissa_t& remainder) const noexcept;
+
+private:
+    friend class BasicPrecisedFloat;
+
+
+    State          state              = State::NaN;
+    magnitude_t    magnitude_order    = 0;
+    mantissa_t     mantissa           = 0;
+
+    int            shift              = 0;
+    mantissa_t     normalized         = 0;
+    mantissa_t     reciprocal         = 0;
+};
+
+
+// Exact sum of any count of numbers: wide integers at the biggest magnitude order added so far, one for the
+// negative and one for the positive numbers. Adding a number costs one multiplication by a power of the radix
+// and two additions with a rare carry, no overflow is possible before 2^63 numbers are added
+template<typename Mantissa, typename Magnitude>
+class BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator {
+public:
+    // Magnitude order of a product of two numbers within MAGNITUDE_ORDER_LIMIT, bigger ones make the sum NaN
+    static constexpr magnitude_t MAX_MAGNITUDE_ORDER = 2 * MAGNITUDE_ORDER_LIMIT;
+
+
+    Accumulator() = default;
+
+
+    Accumulator& add(const BasicPrecisedFloat& p_float) noexcept;
+    Accumulator& add(std::span<const BasicPrecisedFloat> p_floats) noexcept;
+    // Adds <lhs> * <rhs> without rounding and without the overflow of operator*=
+    Accumulator& add_product(const BasicPrecisedFloat& lhs, const BasicPrecisedFloat& rhs) noexcept;
+    Accumulator& merge(const Accumulator& other) noexcept;
+
+
+    // The sum without trailing fraction zeros. Fraction digits which do not fit into <mantissa_t> are truncated,
+    // NaN when the integer part does not fit or when NaN was added
+    BasicPrecisedFloat result() const noexcept;
+
+private:
+    using limb_t        = unsigned long long;
+    using u64_p_float_t = BasicPrecisedFloat<unsigned long long, Magnitude>;
+
+
+    static constexpr int         LIMB_BITS                = 64;
+    static constexpr std::size_t MANTISSA_LIMBS_COUNT     = (MANTISSA_DIGITS + LIMB_BITS - 1) / LIMB_BITS;
+    // The biggest scaled product of mantissas (log2(10) < 3402 / 1024), 2^63 of them and the sign of their difference
+    static constexpr std::size_t LIMBS_COUNT              = (2 * MANTISSA_DIGITS + (MAX_MAGNITUDE_ORDER * 3402 >> 10) + 1 + 63 + 1 + LIMB_BITS - 1) / LIMB_BITS;
+    // 10^19 is the biggest power of the radix in a limb
+    static constexpr std::size_t LIMB_RADIX_POWERS_COUNT  = 20;
+
+    using limbs_t = std::array<limb_t, LIMBS_COUNT>;
+
+
+    // <high> * 2^MANTISSA_DIGITS + <low>
+    static limbs_t to_limbs(const mantissa_t high, const mantissa_t low) noexcept;
+    // <number> *= RADIX^shift
+    static void multiply_by_radix_power(limbs_t& number, std::size_t shift) noexcept;
+    // <number> /= RADIX for a non-negative <number>, returns the remainder
+    static limb_t divide_by_radix(limbs_t& number) noexcept;
+    // <sum> += <high> * 2^LIMB_BITS + <low>, which carries further seldom
+    static void add_two_limbs(limbs_t& sum, limb_t high, const limb_t low) noexcept;
+    // <sum> += <term>, or <sum> -= <term> in two's complement when <negative>
+    static void add_limbs(limbs_t& sum, const limbs_t& term, const bool negative) noexcept;
+    void rescale(const magnitude_t new_magnitude_order) noexcept;
+
+
+    // Indexed by State: the sum of the negative numbers goes first
+    std::array<limbs_t, 2> sums               = {};
+    magnitude_t    magnitude_order    = 0;
+    bool           nan                = false;
+};
+
+
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>::BasicPrecisedFloat(const std::string_view string) noexcept {
     set_from(string);
 }
 
+template<typename Mantissa, typename Magnitude>
 template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T>>
-PrecisedFloat::PrecisedFloat(const T number) {
+         precised_float_details::enable_if_arithmetic_t<T>>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>::BasicPrecisedFloat(const T number) {
     set_from(number);
 }
 
+template<typename Mantissa, typename Magnitude>
+template<typename OtherMantissa,
+         precised_float_details::enable_if_different_t<OtherMantissa, Mantissa>>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>::BasicPrecisedFloat(const BasicPrecisedFloat<OtherMantissa, Magnitude>& other) noexcept : state{static_cast<State>(other.state)},
+                                                                                                                                 magnitude_order{other.magnitude_order},
+                                                                                                                                 mantissa{static_cast<mantissa_t>(other.mantissa)} {
+    if constexpr (sizeof(OtherMantissa) > sizeof(Mantissa)) {
+        if (other.mantissa > MANTISSA_MAX) {
+            set_nan();
+        }
+    }
+}
+
 
-PrecisedFloat& PrecisedFloat::operator=(const std::string& string) & {
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator=(const std::string_view string) & noexcept {
     set_from(string);
 
     return *this;
 }
 
+template<typename Mantissa, typename Magnitude>
 template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T>>
-PrecisedFloat& PrecisedFloat::operator=(const T number) & {
+         precised_float_details::enable_if_arithmetic_t<T>>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator=(const T number) & {
     set_from(number);
 
     return *this;
 }
 
 
-PrecisedFloat& PrecisedFloat::operator+=(const PrecisedFloat& other) & noexcept {
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator+=(const BasicPrecisedFloat& other) & noexcept {
     if (other.state == State::NaN) {
         set_nan();
     } else if (state == other.state) {
@@ -309,39 +889,48 @@ PrecisedFloat& PrecisedFloat::operator+=(const PrecisedFloat& other) & noexcept
     return *this;
 }
 
+template<typename Mantissa, typename Magnitude>
 template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T>>
-PrecisedFloat& PrecisedFloat::operator+=(const T number) & noexcept {
-    return *this += PrecisedFloat{number};
+         precised_float_details::enable_if_arithmetic_t<T>>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator+=(const T number) & noexcept {
+    if constexpr (std::is_integral<T>::value) {
+        add_integer(number, false, false);
+
+        return *this;
+    } else {
+        return *this += BasicPrecisedFloat{number};
+    }
 }
 
-PrecisedFloat PrecisedFloat::operator+(const PrecisedFloat& other) const noexcept {
-    PrecisedFloat temp_p_float{*this};
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> BasicPrecisedFloat<Mantissa, Magnitude>::operator+(const BasicPrecisedFloat& other) const noexcept {
+    BasicPrecisedFloat temp_p_float{*this};
     temp_p_float += other;
 
     return temp_p_float;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-PrecisedFloat operator+(const PrecisedFloat& p_float, const T number) noexcept {
-    PrecisedFloat temp_p_float{number};
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> operator+(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    BasicPrecisedFloat<Mantissa, Magnitude> temp_p_float{number};
     temp_p_float += p_float;
 
     return temp_p_float;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-PrecisedFloat operator+(const T number, const PrecisedFloat& p_float) noexcept {
-    PrecisedFloat temp_p_float{number};
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> operator+(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    BasicPrecisedFloat<Mantissa, Magnitude> temp_p_float{number};
     temp_p_float += p_float;
 
     return temp_p_float;
 }
 
 
-PrecisedFloat& PrecisedFloat::operator-=(const PrecisedFloat& other) & noexcept {
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator-=(const BasicPrecisedFloat& other) & noexcept {
     if (other.state == State::NaN) {
         set_nan();
     } else if (state == other.state) {
@@ -353,39 +942,75 @@ PrecisedFloat& PrecisedFloat::operator-=(const PrecisedFloat& other) & noexcept
     return *this;
 }
 
+template<typename Mantissa, typename Magnitude>
 template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T>>
-PrecisedFloat& PrecisedFloat::operator-=(const T number) & noexcept {
-    return *this -= PrecisedFloat{number};
+         precised_float_details::enable_if_arithmetic_t<T>>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator-=(const T number) & noexcept {
+    if constexpr (std::is_integral<T>::value) {
+        add_integer(number, true, false);
+
+        return *this;
+    } else {
+        return *this -= BasicPrecisedFloat{number};
+    }
 }
 
-PrecisedFloat PrecisedFloat::operator-(const PrecisedFloat& other) const noexcept {
-    PrecisedFloat temp_p_float{*this};
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> BasicPrecisedFloat<Mantissa, Magnitude>::operator-(const BasicPrecisedFloat& other) const noexcept {
+    BasicPrecisedFloat temp_p_float{*this};
     temp_p_float -= other;
 
     return temp_p_float;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-PrecisedFloat operator-(const PrecisedFloat& p_float, const T number) noexcept {
-    PrecisedFloat temp_p_float{number};
-    temp_p_float -= p_float;
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> BasicPrecisedFloat<Mantissa, Magnitude>::operator-() const noexcept {
+    BasicPrecisedFloat temp_p_float{*this};
+    temp_p_float.switch_sign();
 
     return temp_p_float;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-PrecisedFloat operator-(const T number, const PrecisedFloat& p_float) noexcept {
-    PrecisedFloat temp_p_float{number};
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> operator-(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    BasicPrecisedFloat<Mantissa, Magnitude> temp_p_float{p_float};
+    temp_p_float -= number;
+
+    return temp_p_float;
+}
+
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> operator-(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    BasicPrecisedFloat<Mantissa, Magnitude> temp_p_float{number};
     temp_p_float -= p_float;
 
     return temp_p_float;
 }
 
 
-PrecisedFloat& PrecisedFloat::operator*=(const PrecisedFloat& other) & noexcept {
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloat<Mantissa, Magnitude>::sort_key_t BasicPrecisedFloat<Mantissa, Magnitude>::sort_key() const noexcept {
+    sort_key_head_t head = 0;
+    mantissa_t tail = 0;
+    make_sort_key(head, tail);
+
+    sort_key_t key{};
+    for (auto i = sizeof(sort_key_head_t); i-- > 0;) {
+        key[i] = static_cast<unsigned char>(head & 0xFF);
+        head >>= CHAR_BIT;
+    }
+    for (auto i = SORT_KEY_SIZE; i-- > sizeof(sort_key_head_t);) {
+        key[i] = static_cast<unsigned char>(tail & 0xFF);
+        tail >>= CHAR_BIT;
+    }
+
+    return key;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator*=(const BasicPrecisedFloat& other) & noexcept {
     if (other.state == State::NaN) {
         set_nan();
         return *this;
@@ -395,45 +1020,62 @@ PrecisedFloat& PrecisedFloat::operator*=(const PrecisedFloat& other) & noexcept
         switch_sign();
     }
 
-    mantissa *= other.mantissa;
+    mantissa_t high = 0;
+    mantissa_t low = 0;
+    multiply_wide(mantissa, other.mantissa, high, low);
+    if (high != 0) {
+        set_nan();
+        return *this;
+    }
+
+    mantissa = low;
     magnitude_order += other.magnitude_order;
 
     return *this;
 }
 
+template<typename Mantissa, typename Magnitude>
 template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T>>
-PrecisedFloat& PrecisedFloat::operator*=(const T number) & noexcept {
-    return *this *= PrecisedFloat{number};
+         precised_float_details::enable_if_arithmetic_t<T>>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator*=(const T number) & noexcept {
+    if constexpr (std::is_integral<T>::value) {
+        multiply_by_integer(number);
+
+        return *this;
+    } else {
+        return *this *= BasicPrecisedFloat{number};
+    }
 }
 
-PrecisedFloat PrecisedFloat::operator*(const PrecisedFloat& other) const noexcept {
-    PrecisedFloat temp_p_float{*this};
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> BasicPrecisedFloat<Mantissa, Magnitude>::operator*(const BasicPrecisedFloat& other) const noexcept {
+    BasicPrecisedFloat temp_p_float{*this};
     temp_p_float *= other;
 
     return temp_p_float;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-PrecisedFloat operator*(const PrecisedFloat& p_float, const T number) noexcept {
-    PrecisedFloat temp_p_float{number};
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> operator*(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    BasicPrecisedFloat<Mantissa, Magnitude> temp_p_float{number};
     temp_p_float *= p_float;
 
     return temp_p_float;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-PrecisedFloat operator*(const T number, const PrecisedFloat& p_float) noexcept {
-    PrecisedFloat temp_p_float{number};
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> operator*(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    BasicPrecisedFloat<Mantissa, Magnitude> temp_p_float{number};
     temp_p_float *= p_float;
 
     return temp_p_float;
 }
 
 
-PrecisedFloat& PrecisedFloat::operator/=(const PrecisedFloat& other) & noexcept {
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator/=(const BasicPrecisedFloat& other) & noexcept {
     if (state == State::NaN || mantissa == 0) {
         return *this;
     } else if (other.state == State::NaN || other.mantissa == 0) {
@@ -441,428 +1083,1877 @@ PrecisedFloat& PrecisedFloat::operator/=(const PrecisedFloat& other) & noexcept
         return *this;
     }
 
-    PrecisedFloat temp_p_float;
-
-    temp_p_float.state = state;
     if (other.state == State::NEGATIVE) {
-        temp_p_float.switch_sign();
+        switch_sign();
     }
 
-    auto temp_p_float_mantissa = other.mantissa;
-
-    const auto magnitude_order_diff = std::abs(magnitude_order - other.magnitude_order);
-    const auto mantissa_shift = std::pow(std::numeric_limits<PrecisedFloat>::radix, magnitude_order_diff);
-    if (magnitude_order < other.magnitude_order) {
-        mantissa *= mantissa_shift;
-    } else {
-        temp_p_float_mantissa *= mantissa_shift;
-    }
-
-    while (mantissa >= temp_p_float_mantissa) {
-        mantissa -= temp_p_float_mantissa;
-        ++temp_p_float.mantissa;
-    }
-
-    while (mantissa != 0 && temp_p_float.magnitude_order < MAGNITUDE_ORDER_LIMIT) {
-        mantissa *= std::numeric_limits<PrecisedFloat>::radix;
-
-        const auto remainder = mantissa / temp_p_float_mantissa;
-        temp_p_float.mantissa = temp_p_float.mantissa * std::numeric_limits<PrecisedFloat>::radix + remainder;
-
-        mantissa -= temp_p_float_mantissa * remainder;
-        ++temp_p_float.magnitude_order;
-    }
+    make_division(other.mantissa, other.magnitude_order, [divisor = other.mantissa] (const mantissa_t high, const mantissa_t low, mantissa_t& remainder) {
+        return divide_wide(high, low, divisor, remainder);
+    });
 
     return *this;
 }
 
+template<typename Mantissa, typename Magnitude>
 template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T>>
-PrecisedFloat& PrecisedFloat::operator/=(const T number) & noexcept {
-    return *this /= PrecisedFloat{number};
+         precised_float_details::enable_if_arithmetic_t<T>>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator/=(const T number) & noexcept {
+    return *this /= BasicPrecisedFloat{number};
 }
 
-PrecisedFloat PrecisedFloat::operator/(const PrecisedFloat& other) const noexcept {
-    PrecisedFloat temp_p_float{*this};
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> BasicPrecisedFloat<Mantissa, Magnitude>::operator/(const BasicPrecisedFloat& other) const noexcept {
+    BasicPrecisedFloat temp_p_float{*this};
     temp_p_float /= other;
 
     return temp_p_float;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-PrecisedFloat operator/(const PrecisedFloat& p_float, const T number) noexcept {
-    PrecisedFloat temp_p_float{p_float};
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::operator/=(const Divisor& divisor) & noexcept {
+    if (state == State::NaN || mantissa == 0) {
+        return *this;
+    } else if (divisor.state == State::NaN || divisor.mantissa == 0) {
+        set_nan();
+        return *this;
+    }
+
+    if (divisor.state == State::NEGATIVE) {
+        switch_sign();
+    }
+
+    make_division(divisor.mantissa, divisor.magnitude_order, [&divisor] (const mantissa_t high, const mantissa_t low, mantissa_t& remainder) {
+        return divisor.divide_wide(high, low, remainder);
+    });
+
+    return *this;
+}
+
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_arithmetic_t<T> = true>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> operator/(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    BasicPrecisedFloat<Mantissa, Magnitude> temp_p_float{p_float};
     temp_p_float /= number;
 
     return temp_p_float;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-PrecisedFloat operator/(const T number, const PrecisedFloat& p_float) noexcept {
-    PrecisedFloat temp_p_float{number};
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_arithmetic_t<T> = true>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude> operator/(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    BasicPrecisedFloat<Mantissa, Magnitude> temp_p_float{number};
     temp_p_float /= p_float;
 
     return temp_p_float;
 }
 
 
-bool PrecisedFloat::operator==(const PrecisedFloat& other) const noexcept {
-    return state == other.state &&
-           magnitude_order == other.magnitude_order &&
-           mantissa == other.mantissa;
+template<typename Mantissa, typename Magnitude>
+constexpr std::partial_ordering BasicPrecisedFloat<Mantissa, Magnitude>::compare(const BasicPrecisedFloat& other) const noexcept {
+    if (state == State::NaN || other.state == State::NaN) {
+        return std::partial_ordering::unordered;
+    }
+
+    if (mantissa == 0 || other.mantissa == 0) {
+        // Zero is neither positive nor negative whatever its state is
+        if (mantissa == other.mantissa) {
+            return std::partial_ordering::equivalent;
+        }
+
+        const bool is_less = mantissa == 0 ? other.state == State::POSITIVE : state == State::NEGATIVE;
+        return is_less ? std::partial_ordering::less : std::partial_ordering::greater;
+    }
+
+    if (state != other.state) {
+        return state == State::NEGATIVE ? std::partial_ordering::less : std::partial_ordering::greater;
+    }
+
+    // Magnitudes are aligned to the same magnitude order, the one which overflows on alignment is the bigger one
+    auto aligned_mantissa = mantissa;
+    auto other_aligned_mantissa = other.mantissa;
+    std::strong_ordering magnitude_ordering = std::strong_ordering::equal;
+    if (magnitude_order < other.magnitude_order) {
+        magnitude_ordering = scale_up(aligned_mantissa, other.magnitude_order - magnitude_order) ? aligned_mantissa <=> other_aligned_mantissa
+                                                                                                 : std::strong_ordering::greater;
+    } else if (magnitude_order > other.magnitude_order) {
+        magnitude_ordering = scale_up(other_aligned_mantissa, magnitude_order - other.magnitude_order) ? aligned_mantissa <=> other_aligned_mantissa
+                                                                                                       : std::strong_ordering::less;
+    } else {
+        magnitude_ordering = aligned_mantissa <=> other_aligned_mantissa;
+    }
+
+    return state == State::NEGATIVE ? 0 <=> magnitude_ordering : magnitude_ordering <=> 0;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr std::partial_ordering BasicPrecisedFloat<Mantissa, Magnitude>::operator<=>(const BasicPrecisedFloat& other) const noexcept {
+    return compare(other);
+}
+
+
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::operator==(const BasicPrecisedFloat& other) const noexcept {
+    return compare(other) == 0;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator==(const PrecisedFloat& p_float, const T number) noexcept {
-    return p_float == PrecisedFloat{number};
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator==(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    return p_float == BasicPrecisedFloat<Mantissa, Magnitude>{number};
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator==(const T number, const PrecisedFloat& p_float) noexcept {
-    return PrecisedFloat{number} == p_float;
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator==(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    return BasicPrecisedFloat<Mantissa, Magnitude>{number} == p_float;
 }
 
 
-bool PrecisedFloat::operator!=(const PrecisedFloat& other) const noexcept {
-    return !(*this == other);
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::operator!=(const BasicPrecisedFloat& other) const noexcept {
+    return compare(other) != 0;
 }
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator!=(const PrecisedFloat& p_float, const T number) noexcept {
-    return p_float != PrecisedFloat{number};
+
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator!=(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    return p_float != BasicPrecisedFloat<Mantissa, Magnitude>{number};
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator!=(const T number, const PrecisedFloat& p_float) noexcept {
-    return PrecisedFloat{number} != p_float;
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator!=(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    return BasicPrecisedFloat<Mantissa, Magnitude>{number} != p_float;
 }
 
 
-bool PrecisedFloat::operator<(const PrecisedFloat& other) const noexcept {
-    if (*this == other || state == State::NaN || other.state == State::NaN) {
-        return false;
-    }
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::operator<(const BasicPrecisedFloat& other) const noexcept {
+    return compare(other) < 0;
+}
 
-    if (state != other.state) {
-        return state == State::NEGATIVE;
-    }
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator<(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    return p_float < BasicPrecisedFloat<Mantissa, Magnitude>{number};
+}
 
-    return (*this - other).state == State::NEGATIVE;
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator<(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    return BasicPrecisedFloat<Mantissa, Magnitude>{number} < p_float;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator<(const PrecisedFloat& p_float, const T number) noexcept {
-    return p_float < PrecisedFloat{number};
+
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::operator>(const BasicPrecisedFloat& other) const noexcept {
+    return compare(other) > 0;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator<(const T number, const PrecisedFloat& p_float) noexcept {
-    return PrecisedFloat{number} != p_float;
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator>(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    return p_float > BasicPrecisedFloat<Mantissa, Magnitude>{number};
+}
+
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator>(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    return BasicPrecisedFloat<Mantissa, Magnitude>{number} > p_float;
 }
 
 
-bool PrecisedFloat::operator>(const PrecisedFloat& other) const noexcept {
-    return other < *this;
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::operator<=(const BasicPrecisedFloat& other) const noexcept {
+    return compare(other) <= 0;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator>(const PrecisedFloat& p_float, const T number) noexcept {
-    return p_float > PrecisedFloat{number};
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator<=(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    return p_float <= BasicPrecisedFloat<Mantissa, Magnitude>{number};
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator>(const T number, const PrecisedFloat& p_float) noexcept {
-    return PrecisedFloat{number} > p_float;
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator<=(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    return BasicPrecisedFloat<Mantissa, Magnitude>{number} <= p_float;
 }
 
 
-bool PrecisedFloat::operator<=(const PrecisedFloat& other) const noexcept {
-    return !(other < *this);
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::operator>=(const BasicPrecisedFloat& other) const noexcept {
+    return compare(other) >= 0;
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator<=(const PrecisedFloat& p_float, const T number) noexcept {
-    return p_float <= PrecisedFloat{number};
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator>=(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, const T number) noexcept {
+    return p_float >= BasicPrecisedFloat<Mantissa, Magnitude>{number};
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator<=(const T number, const PrecisedFloat& p_float) noexcept {
-    return PrecisedFloat{number} <= p_float;
+template<typename Mantissa, typename Magnitude, typename T,
+         precised_float_details::enable_if_floating_point_t<T> = true>
+constexpr bool operator>=(const T number, const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    return BasicPrecisedFloat<Mantissa, Magnitude>{number} >= p_float;
 }
 
 
-bool PrecisedFloat::operator>=(const PrecisedFloat& other) const noexcept {
-    return !(*this < other);
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>> operator+(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
+
+    return common_p_float_t{lhs} + common_p_float_t{rhs};
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator>=(const PrecisedFloat& p_float, const T number) noexcept {
-    return p_float >= PrecisedFloat{number};
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>> operator-(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
+
+    return common_p_float_t{lhs} - common_p_float_t{rhs};
 }
 
-template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T> = true>
-bool operator>=(const T number, const PrecisedFloat& p_float) noexcept {
-    return PrecisedFloat{number} >= p_float;
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>> operator*(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
+
+    return common_p_float_t{lhs} * common_p_float_t{rhs};
 }
 
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>> operator/(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
 
+    return common_p_float_t{lhs} / common_p_float_t{rhs};
+}
+
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+bool operator==(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
+
+    return common_p_float_t{lhs} == common_p_float_t{rhs};
+}
+
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+bool operator!=(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
+
+    return common_p_float_t{lhs} != common_p_float_t{rhs};
+}
+
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+bool operator<(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
+
+    return common_p_float_t{lhs} < common_p_float_t{rhs};
+}
+
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+bool operator>(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
+
+    return common_p_float_t{lhs} > common_p_float_t{rhs};
+}
+
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+bool operator<=(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
+
+    return common_p_float_t{lhs} <= common_p_float_t{rhs};
+}
+
+template<typename LhsMantissa, typename RhsMantissa, typename Magnitude,
+         precised_float_details::enable_if_different_t<LhsMantissa, RhsMantissa> = true>
+bool operator>=(const BasicPrecisedFloat<LhsMantissa, Magnitude>& lhs, const BasicPrecisedFloat<RhsMantissa, Magnitude>& rhs) noexcept {
+    using common_p_float_t = std::common_type_t<BasicPrecisedFloat<LhsMantissa, Magnitude>, BasicPrecisedFloat<RhsMantissa, Magnitude>>;
+
+    return common_p_float_t{lhs} >= common_p_float_t{rhs};
+}
+
+
+template<typename Mantissa, typename Magnitude>
 template<typename T,
-         PrecisedFloat::enable_if_arithmetic_t<T>>
-PrecisedFloat::operator T() const noexcept {
-    return static_cast<T>(mantissa) / std::pow(std::numeric_limits<PrecisedFloat>::radix, magnitude_order);
+         precised_float_details::enable_if_arithmetic_t<T>>
+BasicPrecisedFloat<Mantissa, Magnitude>::operator T() const noexcept {
+    if constexpr (std::is_floating_point<T>::value) {
+        if (state == State::NaN) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+
+        T value{};
+        if constexpr (std::numeric_limits<T>::digits > std::numeric_limits<double>::digits) {
+            value = static_cast<T>(mantissa) / std::pow(static_cast<T>(RADIX), static_cast<T>(magnitude_order));
+        } else {
+            using floating_point_t = std::conditional_t<std::numeric_limits<T>::digits <= std::numeric_limits<float>::digits, float, double>;
+            value = make_floating_point<floating_point_t>(mantissa, magnitude_order);
+        }
+
+        return state == State::NEGATIVE ? -value : value;
+    } else {
+        using unsigned_t = std::make_unsigned_t<T>;
+
+        if (state == State::NaN) {
+            return 0;
+        }
+
+        const auto integer_part = static_cast<unsigned_t>(scale_down(mantissa, magnitude_order));
+
+        return static_cast<T>(state == State::NEGATIVE ? unsigned_t{0} - integer_part : integer_part);
+    }
 }
 
+template<typename Mantissa, typename Magnitude>
 template<typename T,
-         PrecisedFloat::enable_if_integer_t<T>>
-void PrecisedFloat::set_from(const T integer) noexcept {
-    mantissa = static_cast<PrecisedFloat::mantissa_t>(std::abs(integer));
+         precised_float_details::enable_if_integer_t<T>>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::set_from(const T integer) noexcept {
+    if (!integer_to_mantissa(integer, mantissa)) {
+        set_nan();
+        return;
+    }
+
     state = integer < 0 ? State::NEGATIVE : State::POSITIVE;
     magnitude_order = 0;
 }
 
 
+template<typename Mantissa, typename Magnitude>
 template<typename T,
-         PrecisedFloat::enable_if_floating_point_t<T>>
-void PrecisedFloat::set_from(const T floating_point) noexcept {
-    constexpr auto BUFFER_MAX_LENGTH    = std::numeric_limits<T>::max_exponent10 + 20;
-    constexpr auto FORMAT               = std::is_same<long double, T>::value ? "%.*Lf" : "%.*f";
-    constexpr auto MAX_PRECISION        = std::numeric_limits<T>::digits10;
+         precised_float_details::enable_if_floating_point_t<T>>
+void BasicPrecisedFloat<Mantissa, Magnitude>::set_from(const T floating_point) noexcept {
+    if constexpr (std::numeric_limits<T>::digits > std::numeric_limits<double>::digits) {
+        // Extended long double is still formatted, its significand does not fit the conversion below
+        constexpr auto BUFFER_MAX_LENGTH    = std::numeric_limits<T>::max_exponent10 + 20;
+        constexpr auto MAX_PRECISION        = std::numeric_limits<T>::digits10;
 
-    char buffer[BUFFER_MAX_LENGTH];
-    const auto buffer_length = std::snprintf(buffer, BUFFER_MAX_LENGTH, FORMAT, MAX_PRECISION, floating_point);
+        char buffer[BUFFER_MAX_LENGTH];
+        const auto buffer_length = std::snprintf(buffer, BUFFER_MAX_LENGTH, "%.*Lf", MAX_PRECISION, floating_point);
 
-    set_from(std::string(buffer, buffer_length));
-}
-
-std::string PrecisedFloat::str() const noexcept {
-    std::string string;
+        if (buffer_length <= 0 || buffer_length >= BUFFER_MAX_LENGTH) {
+            set_nan();
+            return;
+        }
 
-    if (state == State::NaN) {
-        string = "NaN";
+        set_from(std::string_view{buffer, static_cast<std::size_t>(buffer_length)});
     } else {
-        string = std::to_string(mantissa);
+        using floating_point_t = std::conditional_t<std::numeric_limits<T>::digits <= std::numeric_limits<float>::digits, float, double>;
 
-        if (magnitude_order == 0) {
-            string.append(".0");
-        } else {
-            if (string.size() <= magnitude_order) {
-                const auto zero_number = magnitude_order - string.size() + 1;
-                string.insert(0, zero_number, ZERO_CHAR);
+        // Numbers from these bounds either round to zero or do not fit into the mantissa
+        constexpr long double ZERO_BOUND = [] {
+            long double bound = 1;
+            for (int i = 0; i < MAGNITUDE_ORDER_LIMIT + 2; ++i) {
+                bound /= RADIX;
             }
 
-            const auto dot_position = string.size() - magnitude_order;
-            string.insert(dot_position, 1, DOT_CHAR);
-        }
+            return bound;
+        }();
+        constexpr long double OVERFLOW_BOUND = [] {
+            long double bound = 1;
+            for (int i = 0; i < MANTISSA_DIGITS; ++i) {
+                bound *= 2;
+            }
+
+            return bound;
+        }();
 
-        if (state == State::NEGATIVE) {
-            string.insert(0, 1, MINUS_CHAR);
+        if (std::isnan(floating_point) || std::isinf(floating_point)) {
+            set_nan();
+            return;
         }
-    }
 
-    return string;
-}
+        state = std::signbit(floating_point) ? State::NEGATIVE : State::POSITIVE;
+        magnitude_order = 0;
+        mantissa = 0;
 
-void PrecisedFloat::make_addition(const PrecisedFloat& p_float) noexcept {
-    if (magnitude_order == p_float.magnitude_order) {
-        mantissa += p_float.mantissa;
+        const auto absolute_value = static_cast<floating_point_t>(std::fabs(floating_point));
+        if (absolute_value < ZERO_BOUND) {
+            return;
+        } else if (absolute_value >= OVERFLOW_BOUND) {
+            set_nan();
+            return;
+        }
 
-        return;
-    }
+        using u64_p_float_t = BasicPrecisedFloat<unsigned long long, Magnitude>;
 
-    const auto magnitude_order_diff = std::abs(magnitude_order - p_float.magnitude_order);
-    const auto mantissa_shift = std::pow(std::numeric_limits<PrecisedFloat>::radix, magnitude_order_diff);
-    if (magnitude_order < p_float.magnitude_order) {
-        magnitude_order = p_float.magnitude_order;
+        unsigned long long significand = 0;
+        int exponent = 0;
+        if (!make_shortest_decimal(absolute_value, significand, exponent)) {
+            set_nan();
+            return;
+        }
 
-        mantissa = mantissa * mantissa_shift + p_float.mantissa;
-    } else {
-        mantissa += p_float.mantissa * mantissa_shift;
-    }
-}
+        // The shortest decimal comes padded with trailing zeros, which a narrow mantissa cannot hold
+        for (const auto step : u64_p_float_t::TRAILING_ZEROS_STEPS) {
+            if (significand % u64_p_float_t::RADIX_POWERS[step] == 0) {
+                significand /= u64_p_float_t::RADIX_POWERS[step];
+                exponent += static_cast<int>(step);
+            }
+        }
 
-void PrecisedFloat::make_subtraction(const PrecisedFloat& p_float) noexcept {
-    const auto compare_and_process = [this] (const mantissa_t p_float_mantissa) {
-        if (mantissa < p_float_mantissa) {
-            switch_sign();
-            return p_float_mantissa - mantissa;
+        if (exponent < -MAGNITUDE_ORDER_LIMIT) {
+            // Rounded half up to MAGNITUDE_ORDER_LIMIT fraction digits
+            const auto shift = static_cast<std::size_t>(-MAGNITUDE_ORDER_LIMIT - exponent);
+            if (shift >= u64_p_float_t::RADIX_POWERS_COUNT) {
+                significand = 0;
+            } else {
+                const auto divisor = u64_p_float_t::RADIX_POWERS[shift];
+                const auto remainder = significand % divisor;
+                significand = significand / divisor + (remainder >= divisor - remainder ? 1 : 0);
+            }
+            exponent = -MAGNITUDE_ORDER_LIMIT;
         }
 
-        return mantissa - p_float_mantissa;
-    };
+        if (significand > MANTISSA_MAX) {
+            set_nan();
+            return;
+        }
 
-    if (magnitude_order == p_float.magnitude_order) {
-        mantissa = compare_and_process(p_float.mantissa);
+        mantissa = static_cast<mantissa_t>(significand);
+        if (exponent >= 0) {
+            if (!scale_up(mantissa, static_cast<std::size_t>(exponent))) {
+                set_nan();
+            }
+            return;
+        }
 
-        return;
+        magnitude_order = static_cast<magnitude_t>(-exponent);
+        remove_trailing_zeros();
     }
+}
 
-    const auto magnitude_order_diff = std::abs(magnitude_order - p_float.magnitude_order);
-    const auto mantissa_shift = std::pow(std::numeric_limits<PrecisedFloat>::radix, magnitude_order_diff);
-    if (magnitude_order < p_float.magnitude_order) {
-        magnitude_order = p_float.magnitude_order;
-        mantissa *= mantissa_shift;
+template<typename Mantissa, typename Magnitude>
+template<typename T>
+bool BasicPrecisedFloat<Mantissa, Magnitude>::make_shortest_decimal(const T floating_point, unsigned long long& significand, int& exponent) noexcept {
+    using bits_t = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+    using u64_p_float_t = BasicPrecisedFloat<unsigned long long, Magnitude>;
+
+    constexpr int SIGNIFICAND_BITS = std::numeric_limits<T>::digits - 1;
+    constexpr int EXPONENT_BITS = sizeof(T) * CHAR_BIT - 1 - SIGNIFICAND_BITS;
+    constexpr int EXPONENT_BIAS = std::numeric_limits<T>::max_exponent - 1 + SIGNIFICAND_BITS;
+
+    const auto bits = std::bit_cast<bits_t>(floating_point);
+    const auto ieee_significand = static_cast<unsigned long long>(bits & ((bits_t{1} << SIGNIFICAND_BITS) - 1));
+    const auto ieee_exponent = static_cast<int>(bits >> SIGNIFICAND_BITS & ((bits_t{1} << EXPONENT_BITS) - 1));
+
+    // floating_point == c * 2^q
+    unsigned long long c = ieee_significand;
+    int q = 1 - EXPONENT_BIAS;
+    if (ieee_exponent != 0) {
+        c |= 1ull << SIGNIFICAND_BITS;
+        q = ieee_exponent - EXPONENT_BIAS;
+
+        // Small integers are exact
+        if (q <= 0 && q > -SIGNIFICAND_BITS - 1 && (c & ((1ull << -q) - 1)) == 0) {
+            significand = c >> -q;
+            exponent = 0;
+            return true;
+        }
+    }
 
-        mantissa = compare_and_process(p_float.mantissa);
-    } else {
-        const auto p_float_mantissa = p_float.mantissa * mantissa_shift;
+    // The rounding interval is [c - 1/2, c + 1/2] * 2^q, narrower below the powers of two,
+    // its bounds belong to it when <c> is even
+    const bool is_even = c % 2 == 0;
+    const bool lower_boundary_is_closer = ieee_significand == 0 && ieee_exponent > 1;
+    const auto cbl = 4 * c - 2 + (lower_boundary_is_closer ? 1 : 0);
+    const auto cb = 4 * c;
+    const auto cbr = 4 * c + 2;
+
+    // k == floor(log10(2^q)) or floor(log10(3/4 * 2^q)), h == q + floor(log2(10^-k)) + 1 is in [0, 4]
+    const int k = lower_boundary_is_closer ? (q * 1262611 - 524031) >> 22 : q * 1262611 >> 22;
+    if (-k < POW10_SIGNIFICANDS_MIN || -k > POW10_SIGNIFICANDS_MAX) {
+        return false;
+    }
+    const int h = q + (-k * 1741647 >> 19) + 1;
+    const auto& pow10 = POW10_SIGNIFICANDS[-k - POW10_SIGNIFICANDS_MIN];
+
+    // Upper half of the 192-bit product <pow10> * <cp>, with the lowest bit set if anything was cut off
+    const auto round_to_odd = [&pow10](const unsigned long long cp) {
+        unsigned long long x_high = 0;
+        unsigned long long x_low = 0;
+        unsigned long long y_high = 0;
+        unsigned long long y_low = 0;
+        u64_p_float_t::multiply_wide(pow10[1], cp, x_high, x_low);
+        u64_p_float_t::multiply_wide(pow10[0], cp, y_high, y_low);
+
+        const auto middle = y_low + x_high;
+        const auto high = y_high + (middle < y_low ? 1 : 0);
+
+        return high | (middle > 1 ? 1 : 0);
+    };
 
-        mantissa = compare_and_process(p_float_mantissa);
+    // The interval and <c> itself scaled by 10^-k, in quarters
+    const auto vbl = round_to_odd(cbl << h);
+    const auto vb = round_to_odd(cb << h);
+    const auto vbr = round_to_odd(cbr << h);
+    const auto lower = vbl + (is_even ? 0 : 1);
+    const auto upper = vbr - (is_even ? 0 : 1);
+
+    // One digit shorter candidates first, then the candidates of full length, then the closest one
+    const auto s = vb / 4;
+    if (s >= 10) {
+        const auto sp = s / 10;
+        const bool up_inside = lower <= 40 * sp;
+        const bool wp_inside = 40 * (sp + 1) <= upper;
+        if (up_inside != wp_inside) {
+            significand = sp + (wp_inside ? 1 : 0);
+            exponent = k + 1;
+            return true;
+        }
     }
-}
 
-void PrecisedFloat::switch_sign() noexcept {
-    if (state == State::POSITIVE) {
-        state = State::NEGATIVE;
-    } else if (state == State::NEGATIVE) {
-        state = State::POSITIVE;
+    const bool u_inside = lower <= 4 * s;
+    const bool w_inside = 4 * (s + 1) <= upper;
+    if (u_inside != w_inside) {
+        significand = s + (w_inside ? 1 : 0);
+        exponent = k;
+        return true;
     }
-}
 
-void PrecisedFloat::set_nan() noexcept {
-    state = State::NaN;
-    magnitude_order = 0;
-    mantissa = 0;
-}
+    const auto middle = 4 * s + 2;
+    significand = s + (vb > middle || (vb == middle && s % 2 != 0) ? 1 : 0);
+    exponent = k;
 
-int PrecisedFloat::char_to_int(const char c) const noexcept {
-    return c - ZERO_CHAR;
+    return true;
 }
 
-PrecisedFloat& PrecisedFloat::precise(const precision_t precision) noexcept {
-    if (magnitude_order <= precision || state == State::NaN)
-        return *this;
-
-    mantissa /= std::pow(std::numeric_limits<PrecisedFloat>::radix, magnitude_order - precision);
-    --mantissa;
+template<typename Mantissa, typename Magnitude>
+template<typename T>
+T BasicPrecisedFloat<Mantissa, Magnitude>::make_floating_point(const mantissa_t mantissa, const magnitude_t magnitude_order) noexcept {
+    using bits_t = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+    using u64_p_float_t = BasicPrecisedFloat<unsigned long long, Magnitude>;
+
+    constexpr int SIGNIFICAND_BITS = std::numeric_limits<T>::digits - 1;
+    constexpr int EXPONENT_BITS = sizeof(T) * CHAR_BIT - 1 - SIGNIFICAND_BITS;
+    constexpr int MINIMUM_EXPONENT = 1 - std::numeric_limits<T>::max_exponent;
+    constexpr int INFINITE_POWER = (1 << EXPONENT_BITS) - 1;
+    // Powers of ten exact in <T> and the least power where the product may be exactly halfway between two numbers
+    constexpr int EXACT_POWERS_COUNT = sizeof(T) == sizeof(std::uint32_t) ? 11 : 23;
+    constexpr int MIN_EXPONENT_ROUND_TO_EVEN = sizeof(T) == sizeof(std::uint32_t) ? -17 : -4;
+    constexpr mantissa_t EXACT_MANTISSA_MAX = [] {
+        if constexpr (MANTISSA_DIGITS > SIGNIFICAND_BITS + 1) {
+            return mantissa_t{1} << (SIGNIFICAND_BITS + 1);
+        } else {
+            return MANTISSA_MAX;
+        }
+    }();
+    static constexpr auto EXACT_POWERS = [] {
+        std::array<T, EXACT_POWERS_COUNT> powers{};
+        T power = 1;
+        for (auto& element : powers) {
+            element = power;
+            power *= 10;
+        }
 
-    magnitude_order = precision;
+        return powers;
+    }();
+
+    if (mantissa == 0) {
+        return 0;
+    } else if (magnitude_order == 0) {
+        return static_cast<T>(mantissa);
+    } else if (magnitude_order < EXACT_POWERS_COUNT && mantissa <= EXACT_MANTISSA_MAX) {
+        return static_cast<T>(mantissa) / EXACT_POWERS[magnitude_order];
+    } else if (magnitude_order > -POW10_SIGNIFICANDS_MIN || mantissa > std::numeric_limits<unsigned long long>::max()) {
+        return make_floating_point_exactly<T>(mantissa, magnitude_order);
+    }
 
-    // Common part - may be moved to the separate function
-    while (mantissa % std::numeric_limits<PrecisedFloat>::radix == 0 && mantissa != 0) {
-        mantissa /= std::numeric_limits<PrecisedFloat>::radix;
-        --magnitude_order;
+    const int q = -static_cast<int>(magnitude_order);
+    const auto& pow10 = POW10_SIGNIFICANDS[q - POW10_SIGNIFICANDS_MIN];
+
+    auto w = static_cast<unsigned long long>(mantissa);
+    const int leading_zeros = std::countl_zero(w);
+    w <<= leading_zeros;
+
+    // The high half of the power is enough unless the bits below the result are all ones
+    constexpr unsigned long long PRECISION_MASK = ~0ull >> (SIGNIFICAND_BITS + 3);
+    unsigned long long high = 0;
+    unsigned long long low = 0;
+    u64_p_float_t::multiply_wide(w, pow10[0], high, low);
+    if ((high & PRECISION_MASK) == PRECISION_MASK) {
+        unsigned long long second_high = 0;
+        unsigned long long second_low = 0;
+        u64_p_float_t::multiply_wide(w, pow10[1], second_high, second_low);
+        low += second_high;
+        if (second_high > low) {
+            ++high;
+        }
     }
 
-    return *this;
-}
+    const int upper_bit = static_cast<int>(high >> 63);
+    const int shift = upper_bit + 64 - SIGNIFICAND_BITS - 3;
+    auto significand = high >> shift;
+    int power2 = ((152170 + 65536) * q >> 16) + 63 + upper_bit - leading_zeros - MINIMUM_EXPONENT;
 
-PrecisedFloat& PrecisedFloat::round(const precision_t precision) noexcept {
-    if (magnitude_order <= precision || state == State::NaN)
-        return *this;
+    if (power2 <= 0) {
+        if (-power2 + 1 >= 64) {
+            return 0;
+        }
 
-    mantissa /= std::pow(std::numeric_limits<PrecisedFloat>::radix, magnitude_order - precision + 1);
-    bool round_up = mantissa % std::numeric_limits<PrecisedFloat>::radix >= 5;
-    mantissa /= std::numeric_limits<PrecisedFloat>::radix;
-    if (round_up)
-        ++mantissa;
+        significand >>= -power2 + 1;
+        significand += significand & 1;
+        significand >>= 1;
+        power2 = significand < (1ull << SIGNIFICAND_BITS) ? 0 : 1;
 
-    magnitude_order = precision;
+        return std::bit_cast<T>(static_cast<bits_t>(static_cast<bits_t>(power2) << SIGNIFICAND_BITS | significand));
+    }
 
-    // Common part - may be moved to the separate function
-    while (mantissa % std::numeric_limits<PrecisedFloat>::radix == 0 && mantissa != 0) {
-        mantissa /= std::numeric_limits<PrecisedFloat>::radix;
-        magnitude_order--;
+    if (low <= 1 && q >= MIN_EXPONENT_ROUND_TO_EVEN && (significand & 3) == 1 && (significand << shift) == high) {
+        significand &= ~1ull;
     }
 
-    return *this;
+    significand += significand & 1;
+    significand >>= 1;
+    if (significand >= (2ull << SIGNIFICAND_BITS)) {
+        significand = 1ull << SIGNIFICAND_BITS;
+        ++power2;
+    }
+    significand &= ~(1ull << SIGNIFICAND_BITS);
+
+    if (power2 >= INFINITE_POWER) {
+        return std::numeric_limits<T>::infinity();
+    }
+
+    return std::bit_cast<T>(static_cast<bits_t>(static_cast<bits_t>(power2) << SIGNIFICAND_BITS | significand));
 }
 
-PrecisedFloat& PrecisedFloat::round_up(const precision_t precision) noexcept {
-    if (magnitude_order <= precision || state == State::NaN)
-        return *this;
+template<typename Mantissa, typename Magnitude>
+template<typename T>
+T BasicPrecisedFloat<Mantissa, Magnitude>::make_floating_point_exactly(const mantissa_t mantissa, const std::size_t magnitude_order) noexcept {
+    using bits_t = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+    using u64_p_float_t = BasicPrecisedFloat<unsigned long long, Magnitude>;
+
+    constexpr int SIGNIFICAND_BITS = std::numeric_limits<T>::digits - 1;
+    constexpr int EXPONENT_BITS = sizeof(T) * CHAR_BIT - 1 - SIGNIFICAND_BITS;
+    constexpr int EXPONENT_BIAS = std::numeric_limits<T>::max_exponent - 1;
+    constexpr int INFINITE_POWER = (1 << EXPONENT_BITS) - 1;
+    // Weight of the lowest bit of the smallest subnormal number
+    constexpr int MIN_LSB_EXPONENT = std::numeric_limits<T>::min_exponent - 1 - SIGNIFICAND_BITS;
+    // Any mantissa divided by 10^ZERO_ORDER is below half of the smallest subnormal number
+    constexpr std::size_t ZERO_ORDER = (1 - MIN_LSB_EXPONENT) * 30103 / 100000 + 2 + MANTISSA_DIGITS10;
+    constexpr int LIMB_BITS = 32;
+    constexpr std::size_t LIMBS_COUNT = (MANTISSA_DIGITS + 2 - MIN_LSB_EXPONENT) / LIMB_BITS + 1;
+
+    if (mantissa == 0 || magnitude_order > ZERO_ORDER) {
+        return 0;
+    }
 
-    mantissa /= std::pow(std::numeric_limits<PrecisedFloat>::radix, magnitude_order - precision);
-    ++mantissa;
+    // <mantissa> * 2^scale / 10^magnitude_order, scaled to keep two bits more than <T> has
+    // but not more than two bits below the smallest subnormal number
+    const int mantissa_bits = MANTISSA_DIGITS - count_leading_zeros(mantissa);
+    const int order_bits = static_cast<int>((magnitude_order * 1741647 >> 19) + 1);
+    const int scale = std::clamp(SIGNIFICAND_BITS + 3 + order_bits - mantissa_bits, 0, 2 - MIN_LSB_EXPONENT);
+
+    std::array<std::uint32_t, LIMBS_COUNT + 1> number{};
+    auto mantissa_part = mantissa;
+    for (auto i = static_cast<std::size_t>(scale / LIMB_BITS); mantissa_part != 0; ++i) {
+        number[i] = static_cast<std::uint32_t>(mantissa_part);
+        if constexpr (sizeof(mantissa_t) > sizeof(std::uint32_t)) {
+            mantissa_part >>= LIMB_BITS;
+        } else {
+            mantissa_part = 0;
+        }
+    }
+    if (const auto bit_shift = scale % LIMB_BITS; bit_shift != 0) {
+        for (auto i = number.size(); i-- > 0;) {
+            number[i] = number[i] << bit_shift | (i > 0 ? number[i - 1] >> (LIMB_BITS - bit_shift) : 0);
+        }
+    }
 
-    magnitude_order = precision;
+    bool inexact = false;
+    const auto divide = [&number, &inexact](const std::uint32_t divisor) {
+        std::uint64_t remainder = 0;
+        for (auto i = number.size(); i-- > 0;) {
+            const auto dividend = remainder << LIMB_BITS | number[i];
+            number[i] = static_cast<std::uint32_t>(dividend / divisor);
+            remainder = dividend % divisor;
+        }
+        inexact |= remainder != 0;
+    };
 
-    // Common part - may be moved to the separate function
-    while (mantissa % std::numeric_limits<PrecisedFloat>::radix == 0 && mantissa != 0) {
-        mantissa /= std::numeric_limits<PrecisedFloat>::radix;
-        magnitude_order--;
+    constexpr std::size_t CHUNK_ORDER = 9;
+    auto remaining_order = magnitude_order;
+    for (; remaining_order >= CHUNK_ORDER; remaining_order -= CHUNK_ORDER) {
+        divide(static_cast<std::uint32_t>(u64_p_float_t::RADIX_POWERS[CHUNK_ORDER]));
+    }
+    if (remaining_order > 0) {
+        divide(static_cast<std::uint32_t>(u64_p_float_t::RADIX_POWERS[remaining_order]));
     }
-    return *this;
-}
 
-PrecisedFloat& PrecisedFloat::round_down(const precision_t precision) noexcept {
-    return precise(precision);
-}
+    int bits = 0;
+    for (auto i = number.size(); i-- > 0;) {
+        if (number[i] != 0) {
+            bits = static_cast<int>(i) * LIMB_BITS + LIMB_BITS - std::countl_zero(number[i]);
+            break;
+        }
+    }
+    if (bits == 0) {
+        return 0;
+    }
 
-bool PrecisedFloat::is_nan() const noexcept {
-    return state == State::NaN;
-}
+    const auto bit_at = [&number](const int position) -> unsigned long long {
+        return number[static_cast<std::size_t>(position / LIMB_BITS)] >> (position % LIMB_BITS) & 1;
+    };
 
-void PrecisedFloat::set_from(const std::string& string) {
-    if (string.empty()) {
-        set_nan();
-        return;
+    int lsb_exponent = std::max(bits - 1 - scale - SIGNIFICAND_BITS, MIN_LSB_EXPONENT);
+    const int lsb_position = lsb_exponent + scale;
+
+    unsigned long long significand = 0;
+    for (int position = bits - 1; position >= lsb_position; --position) {
+        significand = significand << 1 | bit_at(position);
     }
 
-    auto iterator = string.cbegin();
+    // Rounded to nearest, ties to even
+    bool sticky = inexact;
+    for (int position = 0; position < lsb_position - 1 && !sticky; ++position) {
+        sticky = bit_at(position) != 0;
+    }
+    if (bit_at(lsb_position - 1) != 0 && (sticky || significand % 2 != 0)) {
+        ++significand;
+    }
+    if (significand >> (SIGNIFICAND_BITS + 1) != 0) {
+        significand >>= 1;
+        ++lsb_exponent;
+    }
 
-    if (*iterator == MINUS_CHAR) {
-        state = State::NEGATIVE;
-        ++iterator;
-    } else if (std::isdigit(*iterator)) {
-        state = State::POSITIVE;
-    } else {
-        set_nan();
-        return;
+    bits_t biased_exponent = 0;
+    if (significand >= 1ull << SIGNIFICAND_BITS) {
+        biased_exponent = static_cast<bits_t>(lsb_exponent + SIGNIFICAND_BITS + EXPONENT_BIAS);
+        significand -= 1ull << SIGNIFICAND_BITS;
+    }
+    if (biased_exponent >= INFINITE_POWER) {
+        return std::numeric_limits<T>::infinity();
     }
 
-    const auto count_trailing_zeros = [] (const std::string& string) -> precision_t {
-        precision_t trailing_zeros = 0;
-        for (auto iterator = string.crbegin(); *iterator == ZERO_CHAR && iterator + 1 != string.crend() && *(iterator + 1) != DOT_CHAR; ++iterator) {
-            ++trailing_zeros;
+    return std::bit_cast<T>(static_cast<bits_t>(biased_exponent << SIGNIFICAND_BITS | significand));
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloat<Mantissa, Magnitude>::convert_to_double(std::span<const BasicPrecisedFloat> p_floats, std::span<double> doubles) noexcept {
+    constexpr std::size_t EXACT_POWERS_COUNT = 23;
+    constexpr mantissa_t EXACT_MANTISSA_MAX = [] {
+        if constexpr (MANTISSA_DIGITS > std::numeric_limits<double>::digits) {
+            return mantissa_t{1} << std::numeric_limits<double>::digits;
+        } else {
+            return MANTISSA_MAX;
+        }
+    }();
+    static constexpr auto EXACT_POWERS = [] {
+        std::array<double, EXACT_POWERS_COUNT> powers{};
+        double power = 1;
+        for (auto& element : powers) {
+            element = power;
+            power *= 10;
         }
 
-        return trailing_zeros;
+        return powers;
+    }();
+
+    const auto is_exact = [](const BasicPrecisedFloat& p_float) {
+        return p_float.state != State::NaN && p_float.magnitude_order < EXACT_POWERS_COUNT && p_float.mantissa <= EXACT_MANTISSA_MAX;
     };
 
-    const auto trailing_zeros_count = count_trailing_zeros(string);
+    // Every number is divided by an exact power first, the numbers for which it is not correctly rounded are redone
+    const auto count = std::min(p_floats.size(), doubles.size());
+    bool all_exact = true;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& p_float = p_floats[i];
+        const auto order = std::min<std::size_t>(p_float.magnitude_order, EXACT_POWERS_COUNT - 1);
+        const auto value = static_cast<double>(p_float.mantissa) / EXACT_POWERS[order];
+        doubles[i] = p_float.state == State::NEGATIVE ? -value : value;
+        all_exact &= is_exact(p_float);
+    }
 
-    // String representation of floating point number should fit into <mantissa_t> type
-    if (string.size() - trailing_zeros_count - (state == State::NEGATIVE ? /* minus character and dot */ 2 : /* dot only */ 1) > std::numeric_limits<PrecisedFloat::mantissa_t>::digits10) {
-        set_nan();
+    if (all_exact) {
         return;
     }
 
-    bool dot_found = false;
-    const auto end_without_zeros = string.cend() - trailing_zeros_count;
-    for (; iterator < end_without_zeros; ++iterator) {
-        if (*iterator == DOT_CHAR) {
-            if (dot_found || iterator + 1 == end_without_zeros) {
-                set_nan();
-                return;
-            }
-            dot_found = true;
-            continue;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!is_exact(p_floats[i])) {
+            doubles[i] = static_cast<double>(p_floats[i]);
         }
+    }
+}
 
-        if (dot_found) {
-            ++magnitude_order;
-        }
+template<typename Mantissa, typename Magnitude>
+std::string BasicPrecisedFloat<Mantissa, Magnitude>::str() const noexcept {
+    std::string string(count_chars(), ZERO_CHAR);
+    to_chars(string.data(), string.data() + string.size());
 
-        if (!std::isdigit(*iterator)) {
-            set_nan();
-            return;
+    return string;
+}
+
+template<typename Mantissa, typename Magnitude>
+std::to_chars_result BasicPrecisedFloat<Mantissa, Magnitude>::to_chars(char* first, char* last) const noexcept {
+    static constexpr char NAN_CHARS[] = {'N', 'a', 'N'};
+    // Two-digit pairs "00", "01", ..., "99", the digits are written by pairs to halve the divisions
+    static constexpr auto DIGIT_PAIRS = [] {
+        std::array<char, 200> pairs{};
+        for (std::size_t i = 0; i < 100; ++i) {
+            pairs[i * 2] = static_cast<char>(ZERO_CHAR + i / 10);
+            pairs[i * 2 + 1] = static_cast<char>(ZERO_CHAR + i % 10);
         }
 
-        mantissa = mantissa * std::numeric_limits<PrecisedFloat>::radix + char_to_int(*iterator);
+        return pairs;
+    }();
+
+    const auto chars_count = count_chars();
+    if (static_cast<std::size_t>(last - first) < chars_count) {
+        return {last, std::errc::value_too_large};
     }
+
+    if (state == State::NaN) {
+        return {std::copy(std::begin(NAN_CHARS), std::end(NAN_CHARS), first), std::errc{}};
+    }
+
+    // Digits are written from the end, every one straight into its final position
+    auto position = first + chars_count;
+    auto value = mantissa;
+    const auto write_digits = [&position, &value](std::size_t count) {
+        for (; count >= 2; count -= 2) {
+            const auto pair = static_cast<std::size_t>(value % (RADIX * RADIX)) * 2;
+            value /= RADIX * RADIX;
+            *--position = DIGIT_PAIRS[pair + 1];
+            *--position = DIGIT_PAIRS[pair];
+        }
+        if (count == 1) {
+            *--position = static_cast<char>(ZERO_CHAR + value % RADIX);
+            value /= RADIX;
+        }
+    };
+
+    if (magnitude_order == 0) {
+        *--position = ZERO_CHAR;
+    } else {
+        write_digits(magnitude_order);
+    }
+    *--position = DOT_CHAR;
+
+    const auto integer_first = first + (state == State::NEGATIVE ? 1 : 0);
+    write_digits(static_cast<std::size_t>(position - integer_first));
+
+    if (state == State::NEGATIVE) {
+        *first = MINUS_CHAR;
+    }
+
+    return {first + chars_count, std::errc{}};
+}
+
+template<typename Mantissa, typename Magnitude>
+std::size_t BasicPrecisedFloat<Mantissa, Magnitude>::count_chars() const noexcept {
+    if (state == State::NaN) {
+        return 3;
+    }
+
+    // At least one digit on each side of the dot
+    const auto digits = count_digits(mantissa);
+    const auto integer_digits = digits > magnitude_order ? digits - magnitude_order : 1;
+    const auto fraction_digits = magnitude_order > 0 ? std::size_t{magnitude_order} : 1;
+
+    return (state == State::NEGATIVE ? 1 : 0) + integer_digits + 1 + fraction_digits;
+}
+
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloat<Mantissa, Magnitude> BasicPrecisedFloat<Mantissa, Magnitude>::fused_multiply_add(const BasicPrecisedFloat& multiplicand, const BasicPrecisedFloat& multiplier,
+                                                                                                     const BasicPrecisedFloat& addend) noexcept {
+    if (multiplicand.state == State::NaN || multiplier.state == State::NaN || addend.state == State::NaN) {
+        return BasicPrecisedFloat{};
+    }
+
+    const auto product_state = multiplicand.state == multiplier.state ? State::POSITIVE : State::NEGATIVE;
+    const std::size_t product_magnitude_order = multiplicand.magnitude_order + multiplier.magnitude_order;
+    const auto result_magnitude_order = std::max<std::size_t>(product_magnitude_order, addend.magnitude_order);
+
+    // Both terms as double-width mantissas at the result magnitude order
+    mantissa_t product_high = 0;
+    mantissa_t product_low = 0;
+    multiply_wide(multiplicand.mantissa, multiplier.mantissa, product_high, product_low);
+    mantissa_t addend_high = 0;
+    mantissa_t addend_low = addend.mantissa;
+
+    bool is_aligned = true;
+    if (product_magnitude_order < result_magnitude_order) {
+        const auto shift = result_magnitude_order - product_magnitude_order;
+        mantissa_t high_high = 0;
+        mantissa_t high_low = 0;
+        if (shift < RADIX_POWERS_COUNT) {
+            multiply_wide(product_high, RADIX_POWERS[shift], high_high, high_low);
+            multiply_wide(product_low, RADIX_POWERS[shift], product_high, product_low);
+            product_high += high_low;
+        }
+        is_aligned = shift < RADIX_POWERS_COUNT && high_high == 0 && product_high >= high_low;
+    } else if (addend.magnitude_order < result_magnitude_order) {
+        const auto shift = result_magnitude_order - addend.magnitude_order;
+        if (shift < RADIX_POWERS_COUNT) {
+            multiply_wide(addend.mantissa, RADIX_POWERS[shift], addend_high, addend_low);
+        }
+        is_aligned = shift < RADIX_POWERS_COUNT;
+    }
+
+    if (is_aligned) {
+        auto result_state = product_state;
+        mantissa_t result_high = 0;
+        mantissa_t result_low = 0;
+        if (product_state == addend.state) {
+            // The sum fits only when both terms and their sum do
+            result_low = product_low + addend_low;
+            result_high = product_high | addend_high | (result_low < addend_low ? 1 : 0);
+        } else {
+            // The smaller term goes from the bigger one, equal terms leave the product sign as operator+ does
+            const bool is_addend_bigger = addend_high > product_high || (addend_high == product_high && addend_low > product_low);
+            result_low = is_addend_bigger ? addend_low - product_low : product_low - addend_low;
+            result_high = is_addend_bigger ? addend_high - product_high - (addend_low < product_low ? 1 : 0)
+                                           : product_high - addend_high - (product_low < addend_low ? 1 : 0);
+            result_state = is_addend_bigger ? addend.state : product_state;
+        }
+
+        if (result_high == 0) [[likely]] {
+            return BasicPrecisedFloat{result_state, static_cast<magnitude_t>(result_magnitude_order), result_low};
+        }
+    }
+
+    return fused_multiply_add_exactly(multiplicand, multiplier, addend);
+}
+
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloat<Mantissa, Magnitude> BasicPrecisedFloat<Mantissa, Magnitude>::fused_multiply_add_exactly(const BasicPrecisedFloat& multiplicand, const BasicPrecisedFloat& multiplier,
+                                                                                                             const BasicPrecisedFloat& addend) noexcept {
+    const auto product_state = multiplicand.state == multiplier.state ? State::POSITIVE : State::NEGATIVE;
+    const auto result_magnitude_order = std::max<std::size_t>(multiplicand.magnitude_order + multiplier.magnitude_order, addend.magnitude_order);
+
+    Accumulator accumulator;
+    accumulator.add_product(multiplicand, multiplier);
+    accumulator.add(addend);
+
+    // The magnitude order of the result goes back when the mantissa fits
+    auto result = accumulator.result();
+    auto result_mantissa = result.mantissa;
+    if (result.state != State::NaN && scale_up(result_mantissa, result_magnitude_order - result.magnitude_order)) {
+        result.magnitude_order = static_cast<magnitude_t>(result_magnitude_order);
+        result.mantissa = result_mantissa;
+    }
+    if (result.state != State::NaN && result.mantissa == 0) {
+        result.state = product_state;
+    }
+
+    return result;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::make_addition(const BasicPrecisedFloat& p_float) noexcept {
+    const auto add = [this] (const mantissa_t p_float_mantissa) {
+        if (mantissa > MANTISSA_MAX - p_float_mantissa) {
+            set_nan();
+            return;
+        }
+
+        mantissa += p_float_mantissa;
+    };
+
+    if (magnitude_order == p_float.magnitude_order) {
+        add(p_float.mantissa);
+
+        return;
+    }
+
+    const std::size_t magnitude_order_diff = magnitude_order < p_float.magnitude_order ? p_float.magnitude_order - magnitude_order
+                                                                                      : magnitude_order - p_float.magnitude_order;
+    if (magnitude_order < p_float.magnitude_order) {
+        if (!scale_up(mantissa, magnitude_order_diff)) {
+            set_nan();
+            return;
+        }
+        magnitude_order = p_float.magnitude_order;
+
+        add(p_float.mantissa);
+    } else {
+        auto p_float_mantissa = p_float.mantissa;
+        if (!scale_up(p_float_mantissa, magnitude_order_diff)) {
+            set_nan();
+            return;
+        }
+
+        add(p_float_mantissa);
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::make_subtraction(const BasicPrecisedFloat& p_float) noexcept {
+    const auto compare_and_process = [this] (const mantissa_t p_float_mantissa) {
+        if (mantissa < p_float_mantissa) {
+            switch_sign();
+            return p_float_mantissa - mantissa;
+        }
+
+        return mantissa - p_float_mantissa;
+    };
+
+    if (magnitude_order == p_float.magnitude_order) {
+        mantissa = compare_and_process(p_float.mantissa);
+
+        return;
+    }
+
+    const std::size_t magnitude_order_diff = magnitude_order < p_float.magnitude_order ? p_float.magnitude_order - magnitude_order
+                                                                                      : magnitude_order - p_float.magnitude_order;
+    if (magnitude_order < p_float.magnitude_order) {
+        if (!scale_up(mantissa, magnitude_order_diff)) {
+            set_nan();
+            return;
+        }
+        magnitude_order = p_float.magnitude_order;
+
+        mantissa = compare_and_process(p_float.mantissa);
+    } else {
+        auto p_float_mantissa = p_float.mantissa;
+        if (!scale_up(p_float_mantissa, magnitude_order_diff)) {
+            set_nan();
+            return;
+        }
+
+        mantissa = compare_and_process(p_float_mantissa);
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+template<typename T>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::add_integer(const T integer, const bool is_subtraction, const bool is_integer_lhs) noexcept {
+    mantissa_t integer_mantissa = 0;
+    if (state == State::NaN || !integer_to_mantissa(integer, integer_mantissa) || !scale_up(integer_mantissa, magnitude_order)) {
+        set_nan();
+        return;
+    }
+
+    // <integer> - *this is -*this + <integer>. Both outcomes are computed and selected
+    const bool is_negative = (state == State::NEGATIVE) != (is_subtraction && is_integer_lhs);
+    const bool is_negative_term = (integer < 0) != (is_subtraction && !is_integer_lhs);
+    const bool is_addition = is_negative == is_negative_term;
+    const bool is_less = mantissa < integer_mantissa;
+    const auto sum = mantissa + integer_mantissa;
+    if (is_addition & (sum < integer_mantissa)) {
+        set_nan();
+        return;
+    }
+
+    const auto less_mask = mantissa_t{0} - static_cast<mantissa_t>(is_less);
+    const auto difference = ((mantissa - integer_mantissa) ^ less_mask) - less_mask;
+    const auto addition_mask = mantissa_t{0} - static_cast<mantissa_t>(is_addition);
+    mantissa = (sum & addition_mask) | (difference & ~addition_mask);
+
+    // The difference changes the sign when the term is bigger, a zero keeps the sign of the left operand
+    const bool is_zero_of_integer = is_integer_lhs & (mantissa == 0);
+    const bool is_negative_result = (is_zero_of_integer & (integer < 0)) | (!is_zero_of_integer & (is_negative != (is_less & !is_addition)));
+    state = is_negative_result ? State::NEGATIVE : State::POSITIVE;
+}
+
+template<typename Mantissa, typename Magnitude>
+template<typename T>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::multiply_by_integer(const T integer) noexcept {
+    mantissa_t integer_mantissa = 0;
+    if (state == State::NaN || !integer_to_mantissa(integer, integer_mantissa)) {
+        set_nan();
+        return;
+    }
+
+    state = (state == State::NEGATIVE) != (integer < 0) ? State::NEGATIVE : State::POSITIVE;
+
+    mantissa_t high = 0;
+    multiply_wide(mantissa, integer_mantissa, high, mantissa);
+    if (high != 0) {
+        set_nan();
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+template<typename T>
+constexpr std::partial_ordering BasicPrecisedFloat<Mantissa, Magnitude>::compare_with_integer(const T integer) const noexcept {
+    mantissa_t integer_mantissa = 0;
+    if (state == State::NaN || !integer_to_mantissa(integer, integer_mantissa)) {
+        return std::partial_ordering::unordered;
+    }
+
+    if (mantissa == 0 || integer_mantissa == 0) {
+        if (mantissa == integer_mantissa) {
+            return std::partial_ordering::equivalent;
+        }
+
+        const bool is_less = mantissa == 0 ? integer > 0 : state == State::NEGATIVE;
+        return is_less ? std::partial_ordering::less : std::partial_ordering::greater;
+    }
+
+    if ((state == State::NEGATIVE) != (integer < 0)) {
+        return state == State::NEGATIVE ? std::partial_ordering::less : std::partial_ordering::greater;
+    }
+
+    // The integer which overflows at the magnitude order of the number is the bigger one
+    const auto magnitude_ordering = scale_up(integer_mantissa, magnitude_order) ? mantissa <=> integer_mantissa : std::strong_ordering::less;
+
+    return state == State::NEGATIVE ? 0 <=> magnitude_ordering : magnitude_ordering <=> 0;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::switch_sign() noexcept {
+    if (state == State::POSITIVE) {
+        state = State::NEGATIVE;
+    } else if (state == State::NEGATIVE) {
+        state = State::POSITIVE;
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::set_nan() noexcept {
+    state = State::NaN;
+    magnitude_order = 0;
+    mantissa = 0;
+}
+
+template<typename Mantissa, typename Magnitude>
+template<typename T>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::integer_to_mantissa(const T integer, mantissa_t& mantissa) noexcept {
+    using unsigned_t = std::make_unsigned_t<T>;
+
+    // Two's complement negation under a mask. Here, in the mixed operators, in the expression terms and in the batch parser
+    // signs and fraction lengths are taken without branches: in real data they are as random as the values, so branches
+    // on them are mispredicted about half of the time
+    const auto negative_mask = static_cast<unsigned_t>(unsigned_t{0} - static_cast<unsigned_t>(integer < 0));
+    const auto magnitude = static_cast<unsigned_t>((static_cast<unsigned_t>(integer) ^ negative_mask) - negative_mask);
+    if constexpr (sizeof(unsigned_t) > sizeof(mantissa_t)) {
+        if (magnitude > MANTISSA_MAX) {
+            return false;
+        }
+    }
+
+    mantissa = static_cast<mantissa_t>(magnitude);
+
+    return true;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::scale_up(mantissa_t& mantissa, const std::size_t shift) noexcept {
+    if (mantissa == 0) {
+        return true;
+    } else if (shift >= RADIX_POWERS_COUNT) {
+        return false;
+    }
+
+    if (mantissa > SCALE_UP_LIMITS[shift]) {
+        return false;
+    }
+
+    mantissa *= RADIX_POWERS[shift];
+
+    return true;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr typename BasicPrecisedFloat<Mantissa, Magnitude>::mantissa_t BasicPrecisedFloat<Mantissa, Magnitude>::scale_down(const mantissa_t mantissa, const std::size_t shift) noexcept {
+    return shift < RADIX_POWERS_COUNT ? mantissa / RADIX_POWERS[shift] : 0;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr std::size_t BasicPrecisedFloat<Mantissa, Magnitude>::count_digits(const mantissa_t mantissa) noexcept {
+    // floor(bits * log10(2)) is the digits count or one less, zero is counted as one digit
+    const auto value = mantissa | 1;
+    const auto bits = static_cast<std::size_t>(MANTISSA_DIGITS - count_leading_zeros(value));
+    const auto digits = bits * 1233 >> 12;
+
+    return digits + (value >= RADIX_POWERS[digits] ? 1 : 0);
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr std::size_t BasicPrecisedFloat<Mantissa, Magnitude>::fraction_digits_after(const mantissa_t integer_part) noexcept {
+    // As many fraction digits as fit next to the integer part, but no more than MAGNITUDE_ORDER_LIMIT
+    const auto integer_part_digits = count_digits(integer_part);
+
+    return integer_part_digits < RADIX_POWERS_COUNT - 1 ? std::min<std::size_t>(MAGNITUDE_ORDER_LIMIT, RADIX_POWERS_COUNT - 1 - integer_part_digits)
+                                                        : 0;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr int BasicPrecisedFloat<Mantissa, Magnitude>::count_leading_zeros(const mantissa_t mantissa) noexcept {
+    if constexpr (sizeof(mantissa_t) <= sizeof(unsigned long long)) {
+        return std::countl_zero(mantissa);
+    } else {
+        constexpr auto HALF_DIGITS = MANTISSA_DIGITS / 2;
+
+        const auto high = static_cast<unsigned long long>(mantissa >> HALF_DIGITS);
+
+        return high != 0 ? std::countl_zero(high) : HALF_DIGITS + std::countl_zero(static_cast<unsigned long long>(mantissa));
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::multiply_wide(const mantissa_t multiplicand, const mantissa_t multiplier, mantissa_t& high, mantissa_t& low) noexcept {
+    if constexpr (!std::is_void<wide_mantissa_t>::value) {
+        const auto product = static_cast<wide_mantissa_t>(multiplicand) * multiplier;
+        high = static_cast<mantissa_t>(product >> MANTISSA_DIGITS);
+        low = static_cast<mantissa_t>(product);
+    } else {
+#if defined(_MSC_VER) && defined(_M_X64)
+        // Intrinsics are not usable in constant evaluation
+        if constexpr (sizeof(mantissa_t) == sizeof(unsigned __int64)) {
+            if (!std::is_constant_evaluated()) {
+                unsigned __int64 product_high;
+                low = _umul128(multiplicand, multiplier, &product_high);
+                high = product_high;
+                return;
+            }
+        }
+#endif
+        constexpr auto HALF_DIGITS = MANTISSA_DIGITS / 2;
+        constexpr auto HALF_MASK = (mantissa_t{1} << HALF_DIGITS) - 1;
+
+        const auto low_low = (multiplicand & HALF_MASK) * (multiplier & HALF_MASK);
+        const auto low_high = (multiplicand & HALF_MASK) * (multiplier >> HALF_DIGITS);
+        const auto high_low = (multiplicand >> HALF_DIGITS) * (multiplier & HALF_MASK);
+        const auto high_high = (multiplicand >> HALF_DIGITS) * (multiplier >> HALF_DIGITS);
+
+        const auto middle = (low_low >> HALF_DIGITS) + (low_high & HALF_MASK) + (high_low & HALF_MASK);
+        high = high_high + (low_high >> HALF_DIGITS) + (high_low >> HALF_DIGITS) + (middle >> HALF_DIGITS);
+        low = (middle << HALF_DIGITS) | (low_low & HALF_MASK);
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr typename BasicPrecisedFloat<Mantissa, Magnitude>::mantissa_t BasicPrecisedFloat<Mantissa, Magnitude>::divide_wide(const mantissa_t high, const mantissa_t low, const mantissa_t divisor, mantissa_t& remainder) noexcept {
+    if constexpr (!std::is_void<wide_mantissa_t>::value) {
+        const auto dividend = static_cast<wide_mantissa_t>(high) << MANTISSA_DIGITS | low;
+        const auto quotient = static_cast<mantissa_t>(dividend / divisor);
+        remainder = static_cast<mantissa_t>(low - quotient * divisor);
+
+        return quotient;
+    } else {
+#if defined(_MSC_VER) && defined(_M_X64)
+        if constexpr (sizeof(mantissa_t) == sizeof(unsigned __int64)) {
+            if (!std::is_constant_evaluated()) {
+                unsigned __int64 wide_remainder;
+                const auto quotient = _udiv128(high, low, divisor, &wide_remainder);
+                remainder = wide_remainder;
+
+                return quotient;
+            }
+        }
+#endif
+        // Restoring division: quotient bits are shifted into <quotient> while <remainder> keeps the partial remainder
+        auto quotient = low;
+        remainder = high;
+        for (auto bit = 0; bit < MANTISSA_DIGITS; ++bit) {
+            const bool carry = (remainder >> (MANTISSA_DIGITS - 1)) != 0;
+            remainder = (remainder << 1) | (quotient >> (MANTISSA_DIGITS - 1));
+            quotient <<= 1;
+            if (carry || remainder >= divisor) {
+                remainder -= divisor;
+                quotient |= 1;
+            }
+        }
+
+        return quotient;
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+template<typename WideDivision>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::make_division(const mantissa_t divisor_mantissa, const magnitude_t divisor_magnitude_order, const WideDivision& wide_division) noexcept {
+    mantissa_t high = 0;
+    mantissa_t low = 0;
+    mantissa_t remainder = 0;
+    std::size_t fraction_digits = 0;
+
+    if (magnitude_order <= divisor_magnitude_order) {
+        // Quotient = <mantissa> * RADIX^shift / <divisor_mantissa>
+        const std::size_t shift = divisor_magnitude_order - magnitude_order;
+        if (shift >= RADIX_POWERS_COUNT) {
+            set_nan();
+            return;
+        }
+
+        multiply_wide(mantissa, RADIX_POWERS[shift], high, low);
+        if (high >= divisor_mantissa) {
+            set_nan();
+            return;
+        }
+
+        const auto integer_part = wide_division(high, low, remainder);
+        if (remainder == 0) {
+            mantissa = integer_part;
+            magnitude_order = 0;
+            return;
+        }
+
+        fraction_digits = fraction_digits_after(integer_part);
+        multiply_wide(remainder, RADIX_POWERS[fraction_digits], high, low);
+        mantissa = integer_part * RADIX_POWERS[fraction_digits] + wide_division(high, low, remainder);
+    } else {
+        // Quotient = <mantissa> / <divisor_mantissa> / RADIX^shift
+        const std::size_t shift = magnitude_order - divisor_magnitude_order;
+        const auto quotient = wide_division(0, mantissa, remainder);
+
+        fraction_digits = fraction_digits_after(scale_down(quotient, shift));
+        if (fraction_digits >= shift) {
+            multiply_wide(mantissa, RADIX_POWERS[fraction_digits - shift], high, low);
+            mantissa = wide_division(high, low, remainder);
+        } else {
+            mantissa = scale_down(quotient, shift - fraction_digits);
+        }
+    }
+
+    magnitude_order = static_cast<magnitude_t>(fraction_digits);
+
+    remove_trailing_zeros();
+}
+
+template<typename Mantissa, typename Magnitude>
+template<typename Index>
+void BasicPrecisedFloat<Mantissa, Magnitude>::radix_sort(std::span<BasicPrecisedFloat> p_floats) {
+    // Entries carry the key and the position of the number, which is moved only once at the end
+    struct Entry {
+        mantissa_t      tail;
+        sort_key_head_t head;
+        Index           index;
+    };
+
+    // 11-bit digits: fewer passes than bytes while the histogram still fits into L1 cache
+    constexpr std::size_t DIGIT_BITS = 11;
+    constexpr std::size_t DIGIT_MASK = (std::size_t{1} << DIGIT_BITS) - 1;
+    constexpr std::size_t TAIL_BITS = sizeof(mantissa_t) * CHAR_BIT;
+    constexpr std::size_t DIGITS_COUNT = (SORT_KEY_SIZE * CHAR_BIT + DIGIT_BITS - 1) / DIGIT_BITS;
+    const auto digit_of = [](const Entry& entry, const std::size_t digit) -> std::size_t {
+        const auto shift = digit * DIGIT_BITS;
+        if (shift + DIGIT_BITS <= TAIL_BITS) {
+            return static_cast<std::size_t>(entry.tail >> shift) & DIGIT_MASK;
+        } else if (shift >= TAIL_BITS) {
+            return static_cast<std::size_t>(entry.head >> (shift - TAIL_BITS)) & DIGIT_MASK;
+        }
+
+        return (static_cast<std::size_t>(entry.tail >> shift) |
+                static_cast<std::size_t>(entry.head) << (TAIL_BITS - shift)) & DIGIT_MASK;
+    };
+
+    const auto count = p_floats.size();
+    if (count < 2) {
+        return;
+    }
+
+    std::vector<Entry> entries(count);
+    std::vector<Entry> buffer(count);
+
+    // Histograms of all digits are collected in a single pass
+    std::vector<std::array<std::size_t, DIGIT_MASK + 1>> histograms(DIGITS_COUNT);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& entry = entries[i];
+        p_floats[i].make_sort_key(entry.head, entry.tail);
+        entry.index = static_cast<Index>(i);
+        for (std::size_t digit = 0; digit < DIGITS_COUNT; ++digit) {
+            ++histograms[digit][digit_of(entry, digit)];
+        }
+    }
+
+    for (std::size_t digit = 0; digit < DIGITS_COUNT; ++digit) {
+        auto& histogram = histograms[digit];
+        // The digit is the same in every key, the pass would not change the order
+        if (histogram[digit_of(entries.front(), digit)] == count) {
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for (auto& bucket : histogram) {
+            const auto bucket_size = bucket;
+            bucket = offset;
+            offset += bucket_size;
+        }
+
+        for (const auto& entry : entries) {
+            buffer[histogram[digit_of(entry, digit)]++] = entry;
+        }
+        entries.swap(buffer);
+    }
+
+    const std::vector<BasicPrecisedFloat> p_floats_copy(p_floats.begin(), p_floats.end());
+    for (std::size_t i = 0; i < count; ++i) {
+        p_floats[i] = p_floats_copy[entries[i].index];
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloat<Mantissa, Magnitude>::make_sort_key(sort_key_head_t& head, mantissa_t& tail) const noexcept {
+    constexpr int HEAD_BITS = sizeof(sort_key_head_t) * CHAR_BIT;
+    enum : sort_key_head_t {
+        NEGATIVE_CLASS,
+        ZERO_CLASS,
+        POSITIVE_CLASS,
+        NAN_CLASS
+    };
+    // Any exponent below 128 by absolute value keeps the upper exponent bytes the same,
+    // so radix sort skips the passes over them
+    constexpr sort_key_head_t EXPONENT_BIAS = sort_key_head_t{std::numeric_limits<magnitude_t>::max()} + 129;
+
+    tail = 0;
+    if (state == State::NaN) {
+        head = sort_key_head_t{NAN_CLASS} << (HEAD_BITS - 2);
+        return;
+    } else if (mantissa == 0) {
+        head = sort_key_head_t{ZERO_CLASS} << (HEAD_BITS - 2);
+        return;
+    }
+
+    // Mantissa aligned to RADIX_POWERS_COUNT digits, the high part is a single decimal digit at most
+    const auto digits = count_digits(mantissa);
+    mantissa_t significand_high = 0;
+    multiply_wide(mantissa, RADIX_POWERS[RADIX_POWERS_COUNT - digits], significand_high, tail);
+
+    // Decimal exponent of the leading digit, negative numbers go in the reverse order
+    const auto exponent = static_cast<sort_key_head_t>(digits) - magnitude_order;
+    if (state == State::POSITIVE) {
+        head = sort_key_head_t{POSITIVE_CLASS} << (HEAD_BITS - 2) |
+               (EXPONENT_BIAS + exponent) << CHAR_BIT |
+               static_cast<sort_key_head_t>(significand_high);
+    } else {
+        head = sort_key_head_t{NEGATIVE_CLASS} << (HEAD_BITS - 2) |
+               (EXPONENT_BIAS - exponent) << CHAR_BIT |
+               static_cast<sort_key_head_t>(RADIX - 1 - significand_high);
+        tail = ~tail;
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::remove_trailing_zeros() noexcept {
+    // Zero has more trailing zeros than the steps add up to
+    if (mantissa == 0) {
+        magnitude_order = 0;
+        return;
+    }
+
+    // Binary search over the trailing zeros count: a few divisibility checks by constant powers
+    // instead of a division per zero
+    for (const auto step : TRAILING_ZEROS_STEPS) {
+        if (magnitude_order >= step && mantissa % RADIX_POWERS[step] == 0) {
+            mantissa /= RADIX_POWERS[step];
+            magnitude_order -= static_cast<magnitude_t>(step);
+        }
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr int BasicPrecisedFloat<Mantissa, Magnitude>::char_to_int(const char c) const noexcept {
+    return c - ZERO_CHAR;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::is_digit(const char c) noexcept {
+    return c >= ZERO_CHAR && c <= ZERO_CHAR + 9;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::precise(const precision_t precision) noexcept {
+    if (magnitude_order <= precision || state == State::NaN)
+        return *this;
+
+    mantissa = scale_down(mantissa, magnitude_order - precision);
+    --mantissa;
+
+    magnitude_order = precision;
+
+    remove_trailing_zeros();
+
+    return *this;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::round(const precision_t precision) noexcept {
+    if (magnitude_order <= precision || state == State::NaN)
+        return *this;
+
+    mantissa = scale_down(mantissa, magnitude_order - precision + 1);
+    bool round_up = mantissa % RADIX >= 5;
+    mantissa /= RADIX;
+    if (round_up)
+        ++mantissa;
+
+    magnitude_order = precision;
+
+    remove_trailing_zeros();
+
+    return *this;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::round_up(const precision_t precision) noexcept {
+    if (magnitude_order <= precision || state == State::NaN)
+        return *this;
+
+    mantissa = scale_down(mantissa, magnitude_order - precision);
+    ++mantissa;
+
+    magnitude_order = precision;
+
+    remove_trailing_zeros();
+    return *this;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::round_down(const precision_t precision) noexcept {
+    return precise(precision);
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr BasicPrecisedFloat<Mantissa, Magnitude>& BasicPrecisedFloat<Mantissa, Magnitude>::normalize() noexcept {
+    if (state == State::NaN) {
+        return *this;
+    }
+
+    remove_trailing_zeros();
+    if (mantissa == 0) {
+        state = State::POSITIVE;
+    }
+
+    return *this;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr bool BasicPrecisedFloat<Mantissa, Magnitude>::is_nan() const noexcept {
+    return state == State::NaN;
+}
+
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloat<Mantissa, Magnitude>::Divisor::Divisor(const BasicPrecisedFloat& p_float) noexcept : state{p_float.state},
+                                                                       magnitude_order{p_float.magnitude_order},
+                                                                       mantissa{p_float.mantissa} {
+    if (state == State::NaN || mantissa == 0) {
+        return;
+    }
+
+    shift = count_leading_zeros(mantissa);
+    normalized = mantissa << shift;
+
+    // reciprocal = (RADIX_MAX^2 - 1) / normalized - RADIX_MAX, where RADIX_MAX = 2^digits
+    mantissa_t remainder;
+    reciprocal = BasicPrecisedFloat::divide_wide(~normalized, ~mantissa_t{0}, normalized, remainder);
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloat<Mantissa, Magnitude>::mantissa_t BasicPrecisedFloat<Mantissa, Magnitude>::Divisor::divide_wide(const mantissa_t high, const mantissa_t low, mantissa_t& remainder) const noexcept {
+    constexpr auto DIGITS = MANTISSA_DIGITS;
+
+    const auto normalized_high = shift == 0 ? high : (high << shift) | (low >> (DIGITS - shift));
+    const auto normalized_low = low << shift;
+
+    mantissa_t quotient;
+    mantissa_t quotient_low;
+    BasicPrecisedFloat::multiply_wide(reciprocal, normalized_high, quotient, quotient_low);
+
+    quotient_low += normalized_low;
+    quotient += normalized_high + 1 + (quotient_low < normalized_low ? 1 : 0);
+
+    remainder = normalized_low - quotient * normalized;
+    if (remainder > quotient_low) {
+        --quotient;
+        remainder += normalized;
+    }
+    if (remainder >= normalized) {
+        ++quotient;
+        remainder -= normalized;
+    }
+
+    remainder >>= shift;
+
+    return quotient;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator& BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::add(const BasicPrecisedFloat& p_float) noexcept {
+    if (nan) {
+        return *this;
+    } else if (p_float.state == State::NaN || p_float.magnitude_order > MAX_MAGNITUDE_ORDER) {
+        nan = true;
+        return *this;
+    }
+
+    if (p_float.magnitude_order > magnitude_order) {
+        rescale(p_float.magnitude_order);
+    }
+
+    auto& sum = sums[static_cast<std::size_t>(p_float.state)];
+    const std::size_t shift = magnitude_order - p_float.magnitude_order;
+    if constexpr (MANTISSA_LIMBS_COUNT == 1) {
+        if (shift < LIMB_RADIX_POWERS_COUNT) {
+            limb_t high = 0;
+            limb_t low = 0;
+            u64_p_float_t::multiply_wide(static_cast<limb_t>(p_float.mantissa), u64_p_float_t::RADIX_POWERS[shift], high, low);
+            add_two_limbs(sum, high, low);
+
+            return *this;
+        }
+    }
+
+    auto term = to_limbs(0, p_float.mantissa);
+    multiply_by_radix_power(term, shift);
+    add_limbs(sum, term, false);
+
+    return *this;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator& BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::add(std::span<const BasicPrecisedFloat> p_floats) noexcept {
+    for (const auto& p_float : p_floats) {
+        add(p_float);
+    }
+
+    return *this;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator& BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::add_product(const BasicPrecisedFloat& lhs, const BasicPrecisedFloat& rhs) noexcept {
+    if (nan) {
+        return *this;
+    } else if (lhs.state == State::NaN || rhs.state == State::NaN || lhs.magnitude_order + rhs.magnitude_order > MAX_MAGNITUDE_ORDER) {
+        nan = true;
+        return *this;
+    }
+
+    const auto product_magnitude_order = static_cast<magnitude_t>(lhs.magnitude_order + rhs.magnitude_order);
+    if (product_magnitude_order > magnitude_order) {
+        rescale(product_magnitude_order);
+    }
+
+    mantissa_t high = 0;
+    mantissa_t low = 0;
+    multiply_wide(lhs.mantissa, rhs.mantissa, high, low);
+
+    auto& sum = sums[static_cast<std::size_t>(lhs.state == rhs.state ? State::POSITIVE : State::NEGATIVE)];
+    if constexpr (MANTISSA_DIGITS == LIMB_BITS) {
+        if (product_magnitude_order == magnitude_order) {
+            add_two_limbs(sum, high, low);
+            return *this;
+        }
+    }
+
+    auto term = to_limbs(high, low);
+    multiply_by_radix_power(term, magnitude_order - product_magnitude_order);
+    add_limbs(sum, term, false);
+
+    return *this;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator& BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::merge(const Accumulator& other) noexcept {
+    if (nan || other.nan) {
+        nan = true;
+        return *this;
+    }
+
+    if (other.magnitude_order > magnitude_order) {
+        rescale(other.magnitude_order);
+    }
+
+    for (std::size_t i = 0; i < sums.size(); ++i) {
+        auto other_sum = other.sums[i];
+        multiply_by_radix_power(other_sum, magnitude_order - other.magnitude_order);
+        add_limbs(sums[i], other_sum, false);
+    }
+
+    return *this;
+}
+
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloat<Mantissa, Magnitude> BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::result() const noexcept {
+    if (nan) {
+        return BasicPrecisedFloat{};
+    }
+
+    auto difference = sums[static_cast<std::size_t>(State::POSITIVE)];
+    add_limbs(difference, sums[static_cast<std::size_t>(State::NEGATIVE)], true);
+
+    const bool negative = (difference.back() >> (LIMB_BITS - 1)) != 0;
+    limbs_t magnitude{};
+    add_limbs(magnitude, difference, negative);
+
+    const auto fits = [&magnitude] {
+        for (auto i = MANTISSA_LIMBS_COUNT; i < LIMBS_COUNT; ++i) {
+            if (magnitude[i] != 0) {
+                return false;
+            }
+        }
+
+        return magnitude[0] <= static_cast<limb_t>(MANTISSA_MAX) || MANTISSA_DIGITS >= LIMB_BITS;
+    };
+
+    // Trailing zeros go first, then the digits which do not fit
+    auto result_magnitude_order = magnitude_order;
+    for (; result_magnitude_order > 0; --result_magnitude_order) {
+        auto quotient = magnitude;
+        if (divide_by_radix(quotient) != 0 && fits()) {
+            break;
+        }
+
+        magnitude = quotient;
+    }
+
+    if (!fits()) {
+        return BasicPrecisedFloat{};
+    }
+
+    mantissa_t result_mantissa = 0;
+    for (auto i = MANTISSA_LIMBS_COUNT; i-- > 0;) {
+        if constexpr (MANTISSA_LIMBS_COUNT > 1) {
+            result_mantissa <<= LIMB_BITS;
+        }
+        result_mantissa |= static_cast<mantissa_t>(magnitude[i]);
+    }
+
+    return BasicPrecisedFloat{negative ? State::NEGATIVE : State::POSITIVE, result_magnitude_order, result_mantissa};
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::limbs_t BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::to_limbs(const mantissa_t high, const mantissa_t low) noexcept {
+    limbs_t limbs{};
+    for (const auto& [part, offset] : {std::pair{low, 0}, std::pair{high, MANTISSA_DIGITS}}) {
+        for (auto bit = 0; bit < MANTISSA_DIGITS; bit += LIMB_BITS) {
+            limbs[(offset + bit) / LIMB_BITS] |= static_cast<limb_t>(part >> bit) << ((offset + bit) % LIMB_BITS);
+        }
+    }
+
+    return limbs;
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::multiply_by_radix_power(limbs_t& number, std::size_t shift) noexcept {
+    while (shift > 0) {
+        const auto step = std::min(shift, LIMB_RADIX_POWERS_COUNT - 1);
+        const auto factor = u64_p_float_t::RADIX_POWERS[step];
+
+        limb_t carry = 0;
+        for (auto& limb : number) {
+            limb_t high = 0;
+            limb_t low = 0;
+            u64_p_float_t::multiply_wide(limb, factor, high, low);
+            limb = low + carry;
+            carry = high + (limb < carry ? 1 : 0);
+        }
+
+        shift -= step;
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::limb_t BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::divide_by_radix(limbs_t& number) noexcept {
+    limb_t remainder = 0;
+    for (auto i = LIMBS_COUNT; i-- > 0;) {
+        number[i] = u64_p_float_t::divide_wide(remainder, number[i], RADIX, remainder);
+    }
+
+    return remainder;
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::add_two_limbs(limbs_t& sum, limb_t high, const limb_t low) noexcept {
+    sum[0] += low;
+    high += sum[0] < low ? 1 : 0;
+    sum[1] += high;
+    for (std::size_t i = 2; i < LIMBS_COUNT && sum[i - 1] < high; ++i) {
+        high = 1;
+        ++sum[i];
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::add_limbs(limbs_t& sum, const limbs_t& term, const bool negative) noexcept {
+    // Subtraction adds the two's complement: every bit of the term inverted and one more
+    const limb_t inversion = negative ? ~limb_t{0} : 0;
+    limb_t carry = inversion & 1;
+    for (std::size_t i = 0; i < LIMBS_COUNT; ++i) {
+        const auto limb = term[i] ^ inversion;
+        const auto partial_sum = sum[i] + limb;
+        const limb_t partial_carry = partial_sum < limb ? 1 : 0;
+        sum[i] = partial_sum + carry;
+        carry = partial_carry | (sum[i] < carry ? 1 : 0);
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator::rescale(const magnitude_t new_magnitude_order) noexcept {
+    for (auto& sum : sums) {
+        multiply_by_radix_power(sum, new_magnitude_order - magnitude_order);
+    }
+    magnitude_order = new_magnitude_order;
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr void BasicPrecisedFloat<Mantissa, Magnitude>::set_from(const std::string_view string) noexcept {
+    const auto last = string.data() + string.size();
+    const auto [end, error] = parse(string.data(), last);
+    if (error != std::errc{} || end != last) {
+        set_nan();
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+constexpr std::from_chars_result BasicPrecisedFloat<Mantissa, Magnitude>::parse(const char* first, const char* last) noexcept {
+    auto iterator = first;
+
+    State parsed_state = State::POSITIVE;
+    if (iterator != last && *iterator == MINUS_CHAR) {
+        parsed_state = State::NEGATIVE;
+        ++iterator;
+    }
+
+    mantissa_t parsed_mantissa = 0;
+    bool out_of_range = false;
+    const auto append_digit = [&](const char c) {
+        const auto digit = static_cast<mantissa_t>(char_to_int(c));
+        if (parsed_mantissa > SCALE_UP_LIMITS[1] || parsed_mantissa * RADIX > MANTISSA_MAX - digit) {
+            out_of_range = true;
+        } else {
+            parsed_mantissa = parsed_mantissa * RADIX + digit;
+        }
+    };
+
+    const auto integer_first = iterator;
+    for (; iterator != last && is_digit(*iterator); ++iterator) {
+        append_digit(*iterator);
+    }
+
+    if (iterator == integer_first) {
+        return {first, std::errc::invalid_argument};
+    }
+
+    magnitude_t parsed_magnitude_order = 0;
+    if (iterator != last && *iterator == DOT_CHAR && iterator + 1 != last && is_digit(*(iterator + 1))) {
+        const auto fraction_first = ++iterator;
+        for (; iterator != last && is_digit(*iterator); ++iterator) {
+        }
+
+        // Trailing zeros of the fraction do not change the value
+        auto fraction_last = iterator;
+        while (fraction_last != fraction_first && *(fraction_last - 1) == ZERO_CHAR) {
+            --fraction_last;
+        }
+
+        if (fraction_last - fraction_first > MAGNITUDE_ORDER_LIMIT) {
+            out_of_range = true;
+        } else {
+            for (auto digit_iterator = fraction_first; digit_iterator != fraction_last; ++digit_iterator) {
+                append_digit(*digit_iterator);
+            }
+            parsed_magnitude_order = static_cast<magnitude_t>(fraction_last - fraction_first);
+        }
+    }
+
+    if (out_of_range) {
+        return {iterator, std::errc::result_out_of_range};
+    }
+
+    state = parsed_state;
+    magnitude_order = parsed_magnitude_order;
+    mantissa = parsed_mantissa;
+
+    return {iterator, std::errc{}};
 }
 
 #endif // __PRECISED_FLOAT_H__
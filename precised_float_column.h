@@ -0,0 +1,648 @@
+#ifndef __PRECISED_FLOAT_COLUMN_H__
+#define __PRECISED_FLOAT_COLUMN_H__
+
+
+#include "precised_float.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <vector>
+
+// Define PRECISED_FLOAT_NO_SIMD to build the scalar kernels only
+#if !defined(PRECISED_FLOAT_NO_SIMD)
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define PRECISED_FLOAT_COLUMN_X86_64
+#define PRECISED_FLOAT_COLUMN_TARGET(isa) __attribute__((target(isa)))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define PRECISED_FLOAT_COLUMN_X86_64
+#define PRECISED_FLOAT_COLUMN_TARGET(isa)
+#include <immintrin.h>
+#endif
+#endif
+
+
+namespace precised_float_details {
+    // Every array starts on a cache line, so that SIMD loads do not straddle two of them
+    template<typename T>
+    struct CacheLineAllocator {
+        using value_type = T;
+
+        static constexpr std::align_val_t ALIGNMENT{64};
+
+        CacheLineAllocator() = default;
+        template<typename U>
+        constexpr CacheLineAllocator(const CacheLineAllocator<U>&) noexcept {};
+
+        T* allocate(const std::size_t count) {
+            return static_cast<T*>(::operator new(count * sizeof(T), ALIGNMENT));
+        }
+
+        void deallocate(T* const pointer, const std::size_t) noexcept {
+            ::operator delete(pointer, ALIGNMENT);
+        }
+
+        template<typename U>
+        bool operator==(const CacheLineAllocator<U>&) const noexcept {
+            return true;
+        }
+    };
+
+    template<typename T>
+    using cache_line_vector_t = std::vector<T, CacheLineAllocator<T>>;
+} // namespace precised_float_details
+
+
+// Numbers stored as separate arrays of states, magnitude orders and mantissas, so that element-wise arithmetic
+// runs in SIMD registers. With a shared scale every number has the same magnitude order and no orders array is kept.
+// Element by element, the results are the same as of the BasicPrecisedFloat operators
+template<typename Mantissa,
+         typename Magnitude = unsigned short>
+class BasicPrecisedFloatColumn {
+public:
+    using p_float_t     = BasicPrecisedFloat<Mantissa, Magnitude>;
+    using mantissa_t    = Mantissa;
+    using magnitude_t   = Magnitude;
+
+
+    // Instruction sets of the element-wise kernels, a set the processor lacks falls back to the next narrower one
+    enum class Kernels {
+        SCALAR,
+        AVX2,
+        AVX512
+    };
+
+    static Kernels best_kernels() noexcept;
+
+
+    BasicPrecisedFloatColumn() = default;
+    explicit BasicPrecisedFloatColumn(std::span<const p_float_t> p_floats);
+    // Shared scale: numbers with more fraction digits than <magnitude_order> are truncated towards zero,
+    // numbers which do not fit after scaling up are NaN
+    BasicPrecisedFloatColumn(std::span<const p_float_t> p_floats, const magnitude_t magnitude_order);
+
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    // New numbers are zeros
+    void resize(const std::size_t size);
+    void reserve(const std::size_t capacity);
+    void push_back(const p_float_t& p_float);
+
+
+    bool has_shared_scale() const noexcept;
+    magnitude_t shared_magnitude_order() const noexcept;
+
+
+    p_float_t operator[](const std::size_t index) const noexcept;
+    void set(const std::size_t index, const p_float_t& p_float) noexcept;
+
+
+    // result[i] = lhs[i] op rhs[i] for every i below min(lhs.size(), rhs.size()), <result> may be one of the operands.
+    // The result has a shared scale when both operands have one
+    friend void add(const BasicPrecisedFloatColumn& lhs, const BasicPrecisedFloatColumn& rhs, BasicPrecisedFloatColumn& result,
+                    const Kernels kernels = best_kernels()) {
+        apply<Operation::ADDITION>(lhs.view(), rhs.view(), std::min(lhs.size(), rhs.size()), result, kernels);
+    }
+
+    friend void sub(const BasicPrecisedFloatColumn& lhs, const BasicPrecisedFloatColumn& rhs, BasicPrecisedFloatColumn& result,
+                    const Kernels kernels = best_kernels()) {
+        apply<Operation::SUBTRACTION>(lhs.view(), rhs.view(), std::min(lhs.size(), rhs.size()), result, kernels);
+    }
+
+    friend void mul(const BasicPrecisedFloatColumn& lhs, const BasicPrecisedFloatColumn& rhs, BasicPrecisedFloatColumn& result,
+                    const Kernels kernels = best_kernels()) {
+        apply<Operation::MULTIPLICATION>(lhs.view(), rhs.view(), std::min(lhs.size(), rhs.size()), result, kernels);
+    }
+
+    // result[i] = p_floats[i] * factor
+    friend void scale_by(const BasicPrecisedFloatColumn& p_floats, const p_float_t& factor, BasicPrecisedFloatColumn& result,
+                         const Kernels kernels = best_kernels()) {
+        apply<Operation::MULTIPLICATION>(p_floats.view(), broadcast_view(factor), p_floats.size(), result, kernels);
+    }
+
+private:
+    using State = typename p_float_t::State;
+
+    static_assert(static_cast<signed char>(State::NaN) == -1 &&
+                  static_cast<signed char>(State::NEGATIVE) == 0 &&
+                  static_cast<signed char>(State::POSITIVE) == 1, "SIMD kernels rely on the State values");
+
+
+    // The SIMD kernels are written for 64-bit mantissas and 16-bit magnitude orders
+    static constexpr bool SIMD_KERNELS = sizeof(mantissa_t) == sizeof(std::uint64_t) && sizeof(magnitude_t) == sizeof(std::uint16_t);
+
+
+    enum class Operation {
+        ADDITION,
+        SUBTRACTION,
+        MULTIPLICATION
+    };
+
+
+    // Operand arrays, <magnitude_orders> is nullptr with a shared scale. A broadcast operand is a single number
+    struct View {
+        const State*        states;
+        const magnitude_t*  magnitude_orders;
+        const mantissa_t*   mantissas;
+        magnitude_t         magnitude_order;
+        bool                broadcast;
+
+        p_float_t load(const std::size_t index) const noexcept;
+        magnitude_t magnitude_order_at(const std::size_t index) const noexcept;
+    };
+
+    struct MutableView {
+        State*              states;
+        magnitude_t*        magnitude_orders;
+        mantissa_t*         mantissas;
+        magnitude_t         magnitude_order;
+    };
+
+
+    View view() const noexcept;
+    static View broadcast_view(const p_float_t& p_float) noexcept;
+    MutableView mutable_view() noexcept;
+    static void store(const MutableView& view, const std::size_t index, const p_float_t& p_float) noexcept;
+
+
+    static Kernels detect_kernels() noexcept;
+    template<Operation operation>
+    static void apply(const View& lhs, const View& rhs, const std::size_t size, BasicPrecisedFloatColumn& result, const Kernels kernels);
+    template<Operation operation>
+    static void apply_scalar(const View& lhs, const View& rhs, const MutableView& result, const std::size_t first, const std::size_t last) noexcept;
+#if defined(PRECISED_FLOAT_COLUMN_X86_64)
+    // Both kernels return the count of processed numbers, the rest is left to the scalar code
+    template<Operation operation, bool BroadcastRhs>
+    PRECISED_FLOAT_COLUMN_TARGET("avx2")
+    static std::size_t apply_avx2(const View& lhs, const View& rhs, const MutableView& result, const std::size_t size) noexcept;
+    template<Operation operation, bool BroadcastRhs>
+    PRECISED_FLOAT_COLUMN_TARGET("avx512f")
+    static std::size_t apply_avx512(const View& lhs, const View& rhs, const MutableView& result, const std::size_t size) noexcept;
+#endif
+
+
+    precised_float_details::cache_line_vector_t<State>          states;
+    precised_float_details::cache_line_vector_t<magnitude_t>    magnitude_orders;
+    precised_float_details::cache_line_vector_t<mantissa_t>     mantissas;
+
+    bool           shared_scale       = false;
+    magnitude_t    magnitude_order    = 0;
+};
+
+
+using PrecisedFloatColumn = BasicPrecisedFloatColumn<unsigned long long>;
+
+
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloatColumn<Mantissa, Magnitude>::BasicPrecisedFloatColumn(std::span<const p_float_t> p_floats) {
+    reserve(p_floats.size());
+    for (const auto& p_float : p_floats) {
+        push_back(p_float);
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloatColumn<Mantissa, Magnitude>::BasicPrecisedFloatColumn(std::span<const p_float_t> p_floats, const magnitude_t magnitude_order) : shared_scale{true},
+                                                                                                                                                  magnitude_order{magnitude_order} {
+    reserve(p_floats.size());
+    for (const auto& p_float : p_floats) {
+        push_back(p_float);
+    }
+}
+
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Kernels BasicPrecisedFloatColumn<Mantissa, Magnitude>::best_kernels() noexcept {
+    static const Kernels kernels = detect_kernels();
+
+    return kernels;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Kernels BasicPrecisedFloatColumn<Mantissa, Magnitude>::detect_kernels() noexcept {
+    if constexpr (!SIMD_KERNELS) {
+        return Kernels::SCALAR;
+    }
+
+#if defined(PRECISED_FLOAT_COLUMN_X86_64) && defined(_MSC_VER) && !defined(__clang__)
+    // The processor has to support the instructions and the OS has to save the wide registers
+    int registers[4]{};
+    __cpuid(registers, 1);
+    if ((registers[2] & (1 << 27)) == 0) {
+        return Kernels::SCALAR;
+    }
+
+    const auto saved_state = _xgetbv(0);
+    __cpuidex(registers, 7, 0);
+    if ((registers[1] & (1 << 16)) != 0 && (saved_state & 0xE6) == 0xE6) {
+        return Kernels::AVX512;
+    } else if ((registers[1] & (1 << 5)) != 0 && (saved_state & 0x6) == 0x6) {
+        return Kernels::AVX2;
+    }
+#elif defined(PRECISED_FLOAT_COLUMN_X86_64)
+    if (__builtin_cpu_supports("avx512f")) {
+        return Kernels::AVX512;
+    } else if (__builtin_cpu_supports("avx2")) {
+        return Kernels::AVX2;
+    }
+#endif
+
+    return Kernels::SCALAR;
+}
+
+
+template<typename Mantissa, typename Magnitude>
+std::size_t BasicPrecisedFloatColumn<Mantissa, Magnitude>::size() const noexcept {
+    return mantissas.size();
+}
+
+template<typename Mantissa, typename Magnitude>
+bool BasicPrecisedFloatColumn<Mantissa, Magnitude>::empty() const noexcept {
+    return mantissas.empty();
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloatColumn<Mantissa, Magnitude>::resize(const std::size_t size) {
+    states.resize(size, State::POSITIVE);
+    mantissas.resize(size, 0);
+    if (!shared_scale) {
+        magnitude_orders.resize(size, 0);
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloatColumn<Mantissa, Magnitude>::reserve(const std::size_t capacity) {
+    states.reserve(capacity);
+    mantissas.reserve(capacity);
+    if (!shared_scale) {
+        magnitude_orders.reserve(capacity);
+    }
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloatColumn<Mantissa, Magnitude>::push_back(const p_float_t& p_float) {
+    resize(size() + 1);
+    set(size() - 1, p_float);
+}
+
+
+template<typename Mantissa, typename Magnitude>
+bool BasicPrecisedFloatColumn<Mantissa, Magnitude>::has_shared_scale() const noexcept {
+    return shared_scale;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::magnitude_t BasicPrecisedFloatColumn<Mantissa, Magnitude>::shared_magnitude_order() const noexcept {
+    return magnitude_order;
+}
+
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::p_float_t BasicPrecisedFloatColumn<Mantissa, Magnitude>::operator[](const std::size_t index) const noexcept {
+    return view().load(index);
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloatColumn<Mantissa, Magnitude>::set(const std::size_t index, const p_float_t& p_float) noexcept {
+    store(mutable_view(), index, p_float);
+}
+
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::p_float_t BasicPrecisedFloatColumn<Mantissa, Magnitude>::View::load(const std::size_t index) const noexcept {
+    const auto position = broadcast ? 0 : index;
+    if (states[position] == State::NaN) {
+        return p_float_t{};
+    }
+
+    return p_float_t{states[position], magnitude_order_at(position), mantissas[position]};
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::magnitude_t BasicPrecisedFloatColumn<Mantissa, Magnitude>::View::magnitude_order_at(const std::size_t index) const noexcept {
+    return magnitude_orders != nullptr ? magnitude_orders[index] : magnitude_order;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::View BasicPrecisedFloatColumn<Mantissa, Magnitude>::view() const noexcept {
+    return View{states.data(), shared_scale ? nullptr : magnitude_orders.data(), mantissas.data(), magnitude_order, false};
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::View BasicPrecisedFloatColumn<Mantissa, Magnitude>::broadcast_view(const p_float_t& p_float) noexcept {
+    return View{&p_float.state, nullptr, &p_float.mantissa, p_float.magnitude_order, true};
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::MutableView BasicPrecisedFloatColumn<Mantissa, Magnitude>::mutable_view() noexcept {
+    return MutableView{states.data(), shared_scale ? nullptr : magnitude_orders.data(), mantissas.data(), magnitude_order};
+}
+
+template<typename Mantissa, typename Magnitude>
+void BasicPrecisedFloatColumn<Mantissa, Magnitude>::store(const MutableView& view, const std::size_t index, const p_float_t& p_float) noexcept {
+    if (view.magnitude_orders != nullptr) {
+        view.states[index] = p_float.state;
+        view.magnitude_orders[index] = p_float.magnitude_order;
+        view.mantissas[index] = p_float.mantissa;
+        return;
+    }
+
+    auto mantissa = p_float.mantissa;
+    if (p_float.state == State::NaN) {
+        mantissa = 0;
+    } else if (p_float.magnitude_order > view.magnitude_order) {
+        mantissa = p_float_t::scale_down(mantissa, p_float.magnitude_order - view.magnitude_order);
+    } else if (!p_float_t::scale_up(mantissa, view.magnitude_order - p_float.magnitude_order)) {
+        view.states[index] = State::NaN;
+        view.mantissas[index] = 0;
+        return;
+    }
+
+    view.states[index] = p_float.state;
+    view.mantissas[index] = mantissa;
+}
+
+
+template<typename Mantissa, typename Magnitude>
+template<typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Operation operation>
+void BasicPrecisedFloatColumn<Mantissa, Magnitude>::apply(const View& lhs, const View& rhs, const std::size_t size, BasicPrecisedFloatColumn& result, [[maybe_unused]] const Kernels kernels) {
+    // An operand which is the result too only shrinks here, so that its arrays stay in place under <lhs> and <rhs>
+    result.resize(size);
+
+    // Equal magnitude orders stay equal through every operation, NaN aside
+    result.shared_scale = lhs.magnitude_orders == nullptr && rhs.magnitude_orders == nullptr;
+    if (result.shared_scale) {
+        result.magnitude_orders.clear();
+        result.magnitude_order = operation == Operation::MULTIPLICATION ? static_cast<magnitude_t>(lhs.magnitude_order + rhs.magnitude_order)
+                                                                        : std::max(lhs.magnitude_order, rhs.magnitude_order);
+    } else {
+        result.magnitude_orders.resize(size, 0);
+    }
+
+    const auto result_view = result.mutable_view();
+    std::size_t processed = 0;
+
+#if defined(PRECISED_FLOAT_COLUMN_X86_64)
+    if constexpr (SIMD_KERNELS) {
+        // Columns with different shared scales need every number scaled, the scalar code does it
+        const bool equal_scales = operation == Operation::MULTIPLICATION || lhs.magnitude_orders != nullptr || rhs.magnitude_orders != nullptr ||
+                                  lhs.magnitude_order == rhs.magnitude_order;
+        const auto available_kernels = std::min(kernels, best_kernels());
+
+        if (equal_scales && available_kernels == Kernels::AVX512) {
+            processed = rhs.broadcast ? apply_avx512<operation, true>(lhs, rhs, result_view, size)
+                                      : apply_avx512<operation, false>(lhs, rhs, result_view, size);
+        } else if (equal_scales && available_kernels == Kernels::AVX2) {
+            processed = rhs.broadcast ? apply_avx2<operation, true>(lhs, rhs, result_view, size)
+                                      : apply_avx2<operation, false>(lhs, rhs, result_view, size);
+        }
+    }
+#endif
+
+    apply_scalar<operation>(lhs, rhs, result_view, processed, size);
+}
+
+template<typename Mantissa, typename Magnitude>
+template<typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Operation operation>
+void BasicPrecisedFloatColumn<Mantissa, Magnitude>::apply_scalar(const View& lhs, const View& rhs, const MutableView& result, const std::size_t first, const std::size_t last) noexcept {
+    for (auto i = first; i < last; ++i) {
+        auto p_float = lhs.load(i);
+        if constexpr (operation == Operation::ADDITION) {
+            p_float += rhs.load(i);
+        } else if constexpr (operation == Operation::SUBTRACTION) {
+            p_float -= rhs.load(i);
+        } else {
+            p_float *= rhs.load(i);
+        }
+
+        store(result, i, p_float);
+    }
+}
+
+
+#if defined(PRECISED_FLOAT_COLUMN_X86_64)
+// The kernels compute every branch of the scalar operators for all lanes and select the results by masks.
+// States are widened from bytes to 64-bit lanes next to the mantissas, NaN lanes get zero mantissas and orders
+template<typename Mantissa, typename Magnitude>
+template<typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Operation operation, bool BroadcastRhs>
+PRECISED_FLOAT_COLUMN_TARGET("avx2")
+std::size_t BasicPrecisedFloatColumn<Mantissa, Magnitude>::apply_avx2(const View& lhs, const View& rhs, const MutableView& result, const std::size_t size) noexcept {
+    constexpr std::size_t LANES = 4;
+
+    const auto all_ones = _mm256_set1_epi64x(-1);
+    const auto sign_bit = _mm256_set1_epi64x(static_cast<long long>(1ull << 63));
+    const auto zero = _mm256_setzero_si256();
+    const auto one = _mm256_set1_epi64x(1);
+    // Low byte of every 64-bit lane to the bottom of its 128-bit half
+    const auto pack_shuffle = _mm256_setr_epi8(0, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                               0, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+
+    const auto rhs_broadcast_state_vector = _mm_set1_epi8(static_cast<char>(rhs.states[0]));
+    const auto rhs_broadcast_states = _mm256_set1_epi64x(static_cast<signed char>(rhs.states[0]));
+    const auto rhs_broadcast_mantissas = _mm256_set1_epi64x(static_cast<long long>(rhs.mantissas[0]));
+
+    std::size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        auto lhs_orders = _mm_set1_epi16(static_cast<short>(lhs.magnitude_order));
+        auto rhs_orders = _mm_set1_epi16(static_cast<short>(rhs.magnitude_order));
+        if (lhs.magnitude_orders != nullptr) {
+            lhs_orders = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lhs.magnitude_orders + i));
+        }
+        if (!BroadcastRhs && rhs.magnitude_orders != nullptr) {
+            rhs_orders = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(rhs.magnitude_orders + i));
+        }
+
+        std::int32_t lhs_state_bytes = 0;
+        std::memcpy(&lhs_state_bytes, lhs.states + i, LANES);
+        const auto lhs_state_vector = _mm_cvtsi32_si128(lhs_state_bytes);
+        auto rhs_state_vector = rhs_broadcast_state_vector;
+        if constexpr (!BroadcastRhs) {
+            std::int32_t rhs_state_bytes = 0;
+            std::memcpy(&rhs_state_bytes, rhs.states + i, LANES);
+            rhs_state_vector = _mm_cvtsi32_si128(rhs_state_bytes);
+        }
+
+        if constexpr (operation != Operation::MULTIPLICATION) {
+            // Lanes with different magnitude orders need scaling, the scalar code handles them. NaN lanes do not count
+            const auto nan_lanes = _mm_cvtepi8_epi16(_mm_or_si128(_mm_cmpeq_epi8(lhs_state_vector, _mm_set1_epi8(-1)),
+                                                                  _mm_cmpeq_epi8(rhs_state_vector, _mm_set1_epi8(-1))));
+            if ((_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(lhs_orders, rhs_orders), nan_lanes)) & 0xFF) != 0xFF) {
+                apply_scalar<operation>(lhs, rhs, result, i, i + LANES);
+                continue;
+            }
+        }
+
+        const auto lhs_states = _mm256_cvtepi8_epi64(lhs_state_vector);
+        const auto lhs_mantissas = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs.mantissas + i));
+
+        auto rhs_states = rhs_broadcast_states;
+        auto rhs_mantissas = rhs_broadcast_mantissas;
+        if constexpr (!BroadcastRhs) {
+            rhs_states = _mm256_cvtepi8_epi64(rhs_state_vector);
+            rhs_mantissas = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs.mantissas + i));
+        }
+
+        const auto nan_operands = _mm256_or_si256(_mm256_cmpeq_epi64(lhs_states, all_ones), _mm256_cmpeq_epi64(rhs_states, all_ones));
+        __m256i states;
+        __m256i mantissas;
+        __m256i nan;
+
+        if constexpr (operation == Operation::MULTIPLICATION) {
+            // 64x64-bit product from 32x32-bit ones, it overflows when both high halves are non-zero,
+            // when the cross products do not fit into 32 bits or when adding them carries out
+            const auto lhs_high = _mm256_srli_epi64(lhs_mantissas, 32);
+            const auto rhs_high = _mm256_srli_epi64(rhs_mantissas, 32);
+            const auto low = _mm256_mul_epu32(lhs_mantissas, rhs_mantissas);
+            const auto cross = _mm256_add_epi64(_mm256_mul_epu32(lhs_high, rhs_mantissas), _mm256_mul_epu32(lhs_mantissas, rhs_high));
+            mantissas = _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+
+            const auto high_halves = _mm256_xor_si256(_mm256_or_si256(_mm256_cmpeq_epi64(lhs_high, zero), _mm256_cmpeq_epi64(rhs_high, zero)), all_ones);
+            const auto cross_overflow = _mm256_xor_si256(_mm256_cmpeq_epi64(_mm256_srli_epi64(cross, 32), zero), all_ones);
+            const auto carry = _mm256_cmpgt_epi64(_mm256_xor_si256(low, sign_bit), _mm256_xor_si256(mantissas, sign_bit));
+
+            nan = _mm256_or_si256(_mm256_or_si256(nan_operands, high_halves), _mm256_or_si256(cross_overflow, carry));
+            states = _mm256_and_si256(_mm256_cmpeq_epi64(lhs_states, rhs_states), one);
+        } else {
+            if constexpr (operation == Operation::SUBTRACTION) {
+                // Subtraction is addition of the number with the other sign, NaN stays NaN
+                rhs_states = _mm256_or_si256(_mm256_sub_epi64(one, rhs_states), _mm256_cmpeq_epi64(rhs_states, all_ones));
+            }
+
+            const auto sum = _mm256_add_epi64(lhs_mantissas, rhs_mantissas);
+            const auto carry = _mm256_cmpgt_epi64(_mm256_xor_si256(lhs_mantissas, sign_bit), _mm256_xor_si256(sum, sign_bit));
+            const auto lhs_less = _mm256_cmpgt_epi64(_mm256_xor_si256(rhs_mantissas, sign_bit), _mm256_xor_si256(lhs_mantissas, sign_bit));
+            const auto difference = _mm256_blendv_epi8(_mm256_sub_epi64(lhs_mantissas, rhs_mantissas),
+                                                       _mm256_sub_epi64(rhs_mantissas, lhs_mantissas), lhs_less);
+            const auto same_signs = _mm256_cmpeq_epi64(lhs_states, rhs_states);
+
+            mantissas = _mm256_blendv_epi8(difference, sum, same_signs);
+            states = _mm256_blendv_epi8(lhs_states, rhs_states, _mm256_andnot_si256(same_signs, lhs_less));
+            nan = _mm256_or_si256(nan_operands, _mm256_and_si256(same_signs, carry));
+        }
+
+        states = _mm256_or_si256(states, nan);
+        mantissas = _mm256_andnot_si256(nan, mantissas);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result.mantissas + i), mantissas);
+
+        const auto packed_states = _mm256_shuffle_epi8(states, pack_shuffle);
+        const auto state_bytes = (_mm_cvtsi128_si32(_mm256_castsi256_si128(packed_states)) & 0xFFFF) |
+                                 (_mm_cvtsi128_si32(_mm256_extracti128_si256(packed_states, 1)) << 16);
+        std::memcpy(result.states + i, &state_bytes, LANES);
+
+        if (result.magnitude_orders != nullptr) {
+            const auto orders = operation == Operation::MULTIPLICATION ? _mm_add_epi16(lhs_orders, rhs_orders) : lhs_orders;
+            const auto nan_orders = _mm_cmpeq_epi16(_mm_cvtepi8_epi16(_mm_cvtsi32_si128(state_bytes)), _mm_set1_epi16(-1));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(result.magnitude_orders + i), _mm_andnot_si128(nan_orders, orders));
+        }
+    }
+
+    return i;
+}
+
+template<typename Mantissa, typename Magnitude>
+template<typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Operation operation, bool BroadcastRhs>
+PRECISED_FLOAT_COLUMN_TARGET("avx512f")
+std::size_t BasicPrecisedFloatColumn<Mantissa, Magnitude>::apply_avx512(const View& lhs, const View& rhs, const MutableView& result, const std::size_t size) noexcept {
+    constexpr std::size_t LANES = 8;
+    // The unmasked forms of some intrinsics start from _mm512_undefined_epi32() and make GCC warn about uninitialized
+    // values, their zero-masked forms with every lane set do not
+    constexpr __mmask8 ALL_LANES = 0xFF;
+
+    const auto nan_state = _mm512_set1_epi64(-1);
+    const auto one = _mm512_set1_epi64(1);
+
+    const auto rhs_broadcast_state_vector = _mm_set1_epi8(static_cast<char>(rhs.states[0]));
+    const auto rhs_broadcast_states = _mm512_set1_epi64(static_cast<signed char>(rhs.states[0]));
+    const auto rhs_broadcast_mantissas = _mm512_set1_epi64(static_cast<long long>(rhs.mantissas[0]));
+
+    std::size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        auto lhs_orders = _mm_set1_epi16(static_cast<short>(lhs.magnitude_order));
+        auto rhs_orders = _mm_set1_epi16(static_cast<short>(rhs.magnitude_order));
+        if (lhs.magnitude_orders != nullptr) {
+            lhs_orders = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs.magnitude_orders + i));
+        }
+        if (!BroadcastRhs && rhs.magnitude_orders != nullptr) {
+            rhs_orders = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs.magnitude_orders + i));
+        }
+
+        const auto lhs_state_vector = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lhs.states + i));
+        auto rhs_state_vector = rhs_broadcast_state_vector;
+        if constexpr (!BroadcastRhs) {
+            rhs_state_vector = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(rhs.states + i));
+        }
+
+        if constexpr (operation != Operation::MULTIPLICATION) {
+            const auto nan_lanes = _mm_cvtepi8_epi16(_mm_or_si128(_mm_cmpeq_epi8(lhs_state_vector, _mm_set1_epi8(-1)),
+                                                                  _mm_cmpeq_epi8(rhs_state_vector, _mm_set1_epi8(-1))));
+            if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(lhs_orders, rhs_orders), nan_lanes)) != 0xFFFF) {
+                apply_scalar<operation>(lhs, rhs, result, i, i + LANES);
+                continue;
+            }
+        }
+
+        const auto lhs_states = _mm512_maskz_cvtepi8_epi64(ALL_LANES, lhs_state_vector);
+        const auto lhs_mantissas = _mm512_loadu_si512(lhs.mantissas + i);
+
+        auto rhs_states = rhs_broadcast_states;
+        auto rhs_mantissas = rhs_broadcast_mantissas;
+        if constexpr (!BroadcastRhs) {
+            rhs_states = _mm512_maskz_cvtepi8_epi64(ALL_LANES, rhs_state_vector);
+            rhs_mantissas = _mm512_loadu_si512(rhs.mantissas + i);
+        }
+
+        const __mmask8 nan_operands = _mm512_cmpeq_epi64_mask(lhs_states, nan_state) | _mm512_cmpeq_epi64_mask(rhs_states, nan_state);
+        __m512i states;
+        __m512i mantissas;
+        __mmask8 nan;
+
+        if constexpr (operation == Operation::MULTIPLICATION) {
+            const auto lhs_high = _mm512_maskz_srli_epi64(ALL_LANES, lhs_mantissas, 32);
+            const auto rhs_high = _mm512_maskz_srli_epi64(ALL_LANES, rhs_mantissas, 32);
+            const auto low = _mm512_maskz_mul_epu32(ALL_LANES, lhs_mantissas, rhs_mantissas);
+            const auto cross = _mm512_add_epi64(_mm512_maskz_mul_epu32(ALL_LANES, lhs_high, rhs_mantissas),
+                                                _mm512_maskz_mul_epu32(ALL_LANES, lhs_mantissas, rhs_high));
+            mantissas = _mm512_add_epi64(low, _mm512_maskz_slli_epi64(ALL_LANES, cross, 32));
+
+            const auto cross_high = _mm512_maskz_srli_epi64(ALL_LANES, cross, 32);
+            nan = nan_operands | (_mm512_test_epi64_mask(lhs_high, lhs_high) & _mm512_test_epi64_mask(rhs_high, rhs_high)) |
+                  _mm512_test_epi64_mask(cross_high, cross_high) | _mm512_cmplt_epu64_mask(mantissas, low);
+            states = _mm512_maskz_mov_epi64(_mm512_cmpeq_epi64_mask(lhs_states, rhs_states), one);
+        } else {
+            if constexpr (operation == Operation::SUBTRACTION) {
+                rhs_states = _mm512_mask_mov_epi64(_mm512_sub_epi64(one, rhs_states), _mm512_cmpeq_epi64_mask(rhs_states, nan_state), nan_state);
+            }
+
+            const auto sum = _mm512_add_epi64(lhs_mantissas, rhs_mantissas);
+            const __mmask8 carry = _mm512_cmplt_epu64_mask(sum, lhs_mantissas);
+            const __mmask8 lhs_less = _mm512_cmplt_epu64_mask(lhs_mantissas, rhs_mantissas);
+            const auto difference = _mm512_mask_sub_epi64(_mm512_sub_epi64(lhs_mantissas, rhs_mantissas), lhs_less, rhs_mantissas, lhs_mantissas);
+            const __mmask8 same_signs = _mm512_cmpeq_epi64_mask(lhs_states, rhs_states);
+
+            mantissas = _mm512_mask_mov_epi64(difference, same_signs, sum);
+            states = _mm512_mask_mov_epi64(lhs_states, static_cast<__mmask8>(~same_signs & lhs_less), rhs_states);
+            nan = nan_operands | (same_signs & carry);
+        }
+
+        states = _mm512_mask_mov_epi64(states, nan, nan_state);
+        mantissas = _mm512_maskz_mov_epi64(static_cast<__mmask8>(~nan), mantissas);
+        _mm512_storeu_si512(result.mantissas + i, mantissas);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(result.states + i), _mm512_maskz_cvtepi64_epi8(ALL_LANES, states));
+
+        if (result.magnitude_orders != nullptr) {
+            const auto orders = operation == Operation::MULTIPLICATION ? _mm_add_epi16(lhs_orders, rhs_orders) : lhs_orders;
+            const auto wide_orders = _mm512_maskz_cvtepu16_epi64(static_cast<__mmask8>(~nan), orders);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(result.magnitude_orders + i), _mm512_maskz_cvtepi64_epi16(ALL_LANES, wide_orders));
+        }
+    }
+
+    return i;
+}
+#endif
+
+#endif // __PRECISED_FLOAT_COLUMN_H__
@@ -0,0 +1,356 @@
+#ifndef __PRECISED_FLOAT_COLUMN_FILE_H__
+#define __PRECISED_FLOAT_COLUMN_FILE_H__
+
+
+#include "precised_float_mapped_file.h"
+#include "precised_float_serialization.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <vector>
+
+
+// A column of numbers in a file which is read through a read-only memory mapping, without copying it. The numbers are kept
+// in blocks of block_size() numbers, the last one may be shorter, each in the block format of encode(). The zone map of every
+// block holds its count of numbers, its count of NaN and its smallest and biggest other numbers, so range queries skip
+// the blocks which cannot hold a number of the range without decoding them.
+//
+// The file layout, in the byte order and the structure layout of the machine which wrote it:
+//     Header        "PFCF", the format version, the sizes of <Mantissa>, <Magnitude> and a block entry, the block size
+//                   and the counts of numbers and blocks
+//     Entries       the offset and the size of every block in the file and its zone map
+//     Blocks        the encoded blocks
+template<typename Mantissa,
+         typename Magnitude = unsigned short>
+class BasicPrecisedFloatColumnFile {
+public:
+    using p_float_t     = BasicPrecisedFloat<Mantissa, Magnitude>;
+    using mantissa_t    = Mantissa;
+    using magnitude_t   = Magnitude;
+
+
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 4096;
+
+
+    // The bounds of a block of NaN only are NaN
+    struct ZoneMap {
+        std::size_t    count;
+        std::size_t    nan_count;
+        p_float_t      min;
+        p_float_t      max;
+    };
+
+
+    // Writes <p_floats> into a new file at <path> in blocks of <block_size> numbers, returns false when it cannot be written
+    static bool write(const char* path, std::span<const p_float_t> p_floats, const std::size_t block_size = DEFAULT_BLOCK_SIZE);
+
+
+    // Not open when the file cannot be mapped or is no column file of this type
+    explicit BasicPrecisedFloatColumnFile(const char* path) noexcept;
+
+    BasicPrecisedFloatColumnFile(const BasicPrecisedFloatColumnFile&) = delete;
+    BasicPrecisedFloatColumnFile& operator=(const BasicPrecisedFloatColumnFile&) = delete;
+
+
+    bool is_open() const noexcept;
+
+    std::size_t size() const noexcept;
+    std::size_t block_size() const noexcept;
+    std::size_t blocks_count() const noexcept;
+
+    ZoneMap zone_map(const std::size_t block) const noexcept;
+    // Decodes <block> into the first numbers of <p_floats>, returns their count, 0 when the block is malformed
+    // or <p_floats> is shorter than it
+    std::size_t read_block(const std::size_t block, std::span<p_float_t> p_floats) const noexcept;
+
+
+    // <visit>(index, p_float) gets every number within [<low>, <high>] in the order of their indexes, returns their count
+    template<typename Visitor>
+    std::size_t scan(const p_float_t& low, const p_float_t& high, const Visitor& visit) const;
+    // Count of numbers within [<low>, <high>], the blocks which lie in the range whole are counted by their zone maps
+    std::size_t count(const p_float_t& low, const p_float_t& high) const;
+
+private:
+    using State = typename p_float_t::State;
+
+
+    struct Header {
+        std::uint32_t    magic;
+        std::uint16_t    version;
+        std::uint8_t     mantissa_size;
+        std::uint8_t     magnitude_size;
+        std::uint32_t    entry_size;
+        std::uint32_t    block_size;
+        std::uint64_t    count;
+        std::uint64_t    blocks_count;
+    };
+
+    struct BlockEntry {
+        mantissa_t       min_mantissa;
+        mantissa_t       max_mantissa;
+        std::uint64_t    offset;
+        std::uint64_t    size;
+        std::uint32_t    count;
+        std::uint32_t    nan_count;
+        magnitude_t      min_magnitude_order;
+        magnitude_t      max_magnitude_order;
+        std::int8_t      min_state;
+        std::int8_t      max_state;
+    };
+
+    static_assert(sizeof(Header) == 32, "Header must have no padding");
+
+
+    // "PFCF" as the bytes of a little-endian file, a file of the other byte order does not open
+    static constexpr std::uint32_t MAGIC    = 0x46434650;
+    static constexpr std::uint16_t VERSION  = 1;
+
+
+    enum class Overlap {
+        NONE,
+        PARTIAL,
+        WHOLE
+    };
+
+
+    BlockEntry entry(const std::size_t block) const noexcept;
+    // NaN for the bounds of a block of NaN only and for states no number has
+    static p_float_t bound(const std::int8_t state, const magnitude_t magnitude_order, const mantissa_t mantissa) noexcept;
+    static Overlap overlap(const BlockEntry& block_entry, const p_float_t& low, const p_float_t& high) noexcept;
+    static bool is_valid_range(const p_float_t& low, const p_float_t& high) noexcept;
+
+
+    precised_float_details::MappedFile    file;
+    Header                                header{};
+    bool                                  is_valid    = false;
+};
+
+
+using PrecisedFloatColumnFile = BasicPrecisedFloatColumnFile<unsigned long long>;
+
+
+template<typename Mantissa, typename Magnitude>
+bool BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::write(const char* const path, std::span<const p_float_t> p_floats, const std::size_t block_size) {
+    if (block_size == 0 || block_size > std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+
+    std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+    if (!stream) {
+        return false;
+    }
+
+    // The blocks go after the entries, which are known once the blocks are written
+    const auto blocks_count = (p_floats.size() + block_size - 1) / block_size;
+    std::vector<BlockEntry> entries(blocks_count);
+    std::uint64_t offset = sizeof(Header) + blocks_count * sizeof(BlockEntry);
+    stream.seekp(static_cast<std::streamoff>(offset));
+
+    std::vector<std::byte> bytes(max_encoded_size<p_float_t>(block_size));
+    for (std::size_t block = 0; block < blocks_count; ++block) {
+        const auto block_p_floats = p_floats.subspan(block * block_size, std::min(block_size, p_floats.size() - block * block_size));
+
+        p_float_t min;
+        p_float_t max;
+        std::uint32_t nan_count = 0;
+        for (const auto& p_float : block_p_floats) {
+            if (p_float.state == State::NaN) {
+                ++nan_count;
+                continue;
+            }
+            if (min.state == State::NaN || p_float < min) {
+                min = p_float;
+            }
+            if (max.state == State::NaN || max < p_float) {
+                max = p_float;
+            }
+        }
+
+        const auto end = encode(block_p_floats, bytes.data(), bytes.data() + bytes.size());
+        const auto size = static_cast<std::uint64_t>(end - bytes.data());
+        stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(size));
+
+        auto& block_entry = entries[block];
+        block_entry.min_mantissa = min.mantissa;
+        block_entry.max_mantissa = max.mantissa;
+        block_entry.offset = offset;
+        block_entry.size = size;
+        block_entry.count = static_cast<std::uint32_t>(block_p_floats.size());
+        block_entry.nan_count = nan_count;
+        block_entry.min_magnitude_order = min.magnitude_order;
+        block_entry.max_magnitude_order = max.magnitude_order;
+        block_entry.min_state = static_cast<std::int8_t>(min.state);
+        block_entry.max_state = static_cast<std::int8_t>(max.state);
+        offset += size;
+    }
+
+    const Header file_header{MAGIC, VERSION, sizeof(mantissa_t), sizeof(magnitude_t), sizeof(BlockEntry), static_cast<std::uint32_t>(block_size),
+                        p_floats.size(), blocks_count};
+    stream.seekp(0);
+    stream.write(reinterpret_cast<const char*>(&file_header), sizeof(file_header));
+    stream.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(BlockEntry)));
+    stream.close();
+
+    return !stream.fail();
+}
+
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::BasicPrecisedFloatColumnFile(const char* const path) noexcept : file{path, precised_float_details::MappedFile::Access::RANDOM} {
+    const auto text = file.text();
+    if (!file.is_open() || text.size() < sizeof(Header)) {
+        return;
+    }
+
+    std::memcpy(&header, text.data(), sizeof(Header));
+    is_valid = header.magic == MAGIC && header.version == VERSION && header.mantissa_size == sizeof(mantissa_t) &&
+               header.magnitude_size == sizeof(magnitude_t) && header.entry_size == sizeof(BlockEntry) && header.block_size != 0 &&
+               header.blocks_count == header.count / header.block_size + (header.count % header.block_size != 0 ? 1 : 0) &&
+               header.blocks_count <= (text.size() - sizeof(Header)) / sizeof(BlockEntry);
+}
+
+template<typename Mantissa, typename Magnitude>
+bool BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::is_open() const noexcept {
+    return is_valid;
+}
+
+template<typename Mantissa, typename Magnitude>
+std::size_t BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::size() const noexcept {
+    return is_valid ? static_cast<std::size_t>(header.count) : 0;
+}
+
+template<typename Mantissa, typename Magnitude>
+std::size_t BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::block_size() const noexcept {
+    return is_valid ? header.block_size : 0;
+}
+
+template<typename Mantissa, typename Magnitude>
+std::size_t BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::blocks_count() const noexcept {
+    return is_valid ? static_cast<std::size_t>(header.blocks_count) : 0;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::ZoneMap BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::zone_map(const std::size_t block) const noexcept {
+    const auto block_entry = entry(block);
+    return {block_entry.count, block_entry.nan_count,
+            bound(block_entry.min_state, block_entry.min_magnitude_order, block_entry.min_mantissa),
+            bound(block_entry.max_state, block_entry.max_magnitude_order, block_entry.max_mantissa)};
+}
+
+template<typename Mantissa, typename Magnitude>
+std::size_t BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::read_block(const std::size_t block, std::span<p_float_t> p_floats) const noexcept {
+    if (block >= blocks_count()) {
+        return 0;
+    }
+
+    const auto text = file.text();
+    const auto block_entry = entry(block);
+    if (block_entry.offset > text.size() || block_entry.size > text.size() - block_entry.offset) {
+        return 0;
+    }
+
+    const auto first = reinterpret_cast<const std::byte*>(text.data()) + block_entry.offset;
+    const auto result = decode(std::span<const std::byte>{first, static_cast<std::size_t>(block_entry.size)}, p_floats);
+
+    return result.ptr != nullptr && result.count == block_entry.count ? result.count : 0;
+}
+
+template<typename Mantissa, typename Magnitude>
+template<typename Visitor>
+std::size_t BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::scan(const p_float_t& low, const p_float_t& high, const Visitor& visit) const {
+    if (!is_valid_range(low, high)) {
+        return 0;
+    }
+
+    std::vector<p_float_t> p_floats(block_size());
+    std::size_t matches_count = 0;
+    for (std::size_t block = 0; block < blocks_count(); ++block) {
+        const auto block_overlap = overlap(entry(block), low, high);
+        if (block_overlap == Overlap::NONE) {
+            continue;
+        }
+
+        // Every number but NaN of a block in the range whole is in it
+        const auto count = read_block(block, p_floats);
+        const auto first_index = block * block_size();
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& p_float = p_floats[i];
+            if (block_overlap == Overlap::WHOLE ? p_float.state != State::NaN : low <= p_float && p_float <= high) {
+                visit(first_index + i, p_float);
+                ++matches_count;
+            }
+        }
+    }
+
+    return matches_count;
+}
+
+template<typename Mantissa, typename Magnitude>
+std::size_t BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::count(const p_float_t& low, const p_float_t& high) const {
+    if (!is_valid_range(low, high)) {
+        return 0;
+    }
+
+    std::vector<p_float_t> p_floats;
+    std::size_t matches_count = 0;
+    for (std::size_t block = 0; block < blocks_count(); ++block) {
+        const auto block_entry = entry(block);
+        const auto block_overlap = overlap(block_entry, low, high);
+        if (block_overlap == Overlap::WHOLE) {
+            matches_count += block_entry.count - block_entry.nan_count;
+        } else if (block_overlap == Overlap::PARTIAL) {
+            p_floats.resize(block_size());
+            const auto count = read_block(block, p_floats);
+            for (std::size_t i = 0; i < count; ++i) {
+                matches_count += low <= p_floats[i] && p_floats[i] <= high ? 1 : 0;
+            }
+        }
+    }
+
+    return matches_count;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::BlockEntry BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::entry(const std::size_t block) const noexcept {
+    BlockEntry block_entry{};
+    if (block < blocks_count()) {
+        std::memcpy(&block_entry, file.text().data() + sizeof(Header) + block * sizeof(BlockEntry), sizeof(BlockEntry));
+    }
+
+    return block_entry;
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::p_float_t BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::bound(const std::int8_t state,
+                                                                                                                               const magnitude_t magnitude_order,
+                                                                                                                               const mantissa_t mantissa) noexcept {
+    if (state != static_cast<std::int8_t>(State::NEGATIVE) && state != static_cast<std::int8_t>(State::POSITIVE)) {
+        return p_float_t{};
+    }
+
+    return p_float_t{static_cast<State>(state), magnitude_order, mantissa};
+}
+
+template<typename Mantissa, typename Magnitude>
+typename BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::Overlap BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::overlap(const BlockEntry& block_entry,
+                                                                                                                               const p_float_t& low,
+                                                                                                                               const p_float_t& high) noexcept {
+    const auto min = bound(block_entry.min_state, block_entry.min_magnitude_order, block_entry.min_mantissa);
+    const auto max = bound(block_entry.max_state, block_entry.max_magnitude_order, block_entry.max_mantissa);
+    if (block_entry.nan_count >= block_entry.count || min.state == State::NaN || max.state == State::NaN || max < low || high < min) {
+        return Overlap::NONE;
+    }
+
+    return low <= min && max <= high ? Overlap::WHOLE : Overlap::PARTIAL;
+}
+
+template<typename Mantissa, typename Magnitude>
+bool BasicPrecisedFloatColumnFile<Mantissa, Magnitude>::is_valid_range(const p_float_t& low, const p_float_t& high) noexcept {
+    return low.state != State::NaN && high.state != State::NaN && low <= high;
+}
+
+#endif // __PRECISED_FLOAT_COLUMN_FILE_H__
@@ -0,0 +1,112 @@
+#ifndef __PRECISED_FLOAT_CSV_H__
+#define __PRECISED_FLOAT_CSV_H__
+
+
+#include "precised_float_mapped_file.h"
+#include "precised_float_parsing.h"
+#include "precised_float_reductions.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+// Reads the decimal <columns> (zero-based, in any order) of a CSV or TSV file into <results>, one vector per column
+// in the order of <columns>. Records end with "\n" or "\r\n" and their fields are split by <separator>, quoted fields
+// are not supported. Every field gives what the string constructor gives for it: malformed, empty and missing fields
+// are NaN, empty lines are skipped. The file is memory-mapped and split at record boundaries into chunks which are parsed
+// on up to <threads_count> threads, 0 is one per core. Returns false and leaves <results> empty when the file cannot be read
+template<typename Mantissa, typename Magnitude>
+bool read_csv_columns(const char* const path, std::span<const std::size_t> columns, std::vector<std::vector<BasicPrecisedFloat<Mantissa, Magnitude>>>& results,
+                      const char separator = ',', const bool has_header = false, const unsigned threads_count = 0,
+                      const typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Kernels kernels = BasicPrecisedFloatColumn<Mantissa, Magnitude>::best_kernels()) {
+    using p_float_t = BasicPrecisedFloat<Mantissa, Magnitude>;
+    using parser_t  = precised_float_details::BatchParser<Mantissa, Magnitude>;
+    constexpr auto NO_SLOT = ~std::size_t{0};
+
+    results.clear();
+    const precised_float_details::MappedFile file{path};
+    if (!file.is_open()) {
+        return false;
+    }
+
+    auto text = file.text();
+    if (has_header) {
+        text.remove_prefix(std::min(text.find('\n'), text.size() - 1) + 1);
+    }
+
+    // The slot in <results> of every column, a column given twice is read once into its first slot
+    std::vector<std::size_t> slots(columns.empty() ? 0 : *std::max_element(columns.begin(), columns.end()) + 1, NO_SLOT);
+    for (auto slot = columns.size(); slot-- > 0;) {
+        slots[columns[slot]] = slot;
+    }
+
+    // A chunk takes the records which start in it
+    const auto record_first = [text](const std::size_t position) {
+        if (position == 0 || position >= text.size()) {
+            return std::min(position, text.size());
+        }
+
+        return std::min(text.find('\n', position - 1), text.size() - 1) + 1;
+    };
+
+    const auto field_kernels = parser_t::available_kernels(kernels);
+    const auto text_last = text.data() + text.size();
+    auto chunks = precised_float_details::reduce_chunks(text.size(), threads_count, [&](const std::size_t first, const std::size_t last) {
+        std::vector<std::vector<p_float_t>> chunk(columns.size());
+        const auto records_first = record_first(first);
+        const auto records_last = record_first(last);
+        if (records_first >= records_last) {
+            return chunk;
+        }
+
+        std::size_t column = 0;
+        parser_t::split(text.substr(records_first, records_last - records_first), separator, field_kernels,
+                        [&](const std::string_view field, const bool is_line_end) {
+            if (is_line_end && column == 0 && field.empty()) {
+                return;
+            }
+
+            if (column < slots.size() && slots[column] != NO_SLOT) {
+                chunk[slots[column]].push_back(parser_t::parse_field(field, text_last, field_kernels));
+            }
+            ++column;
+
+            // Fields missing from a short record
+            if (is_line_end) {
+                for (; column < slots.size(); ++column) {
+                    if (slots[column] != NO_SLOT) {
+                        chunk[slots[column]].emplace_back();
+                    }
+                }
+                column = 0;
+            }
+        });
+
+        return chunk;
+    });
+
+    results.resize(columns.size());
+    for (std::size_t slot = 0; slot < columns.size(); ++slot) {
+        const auto read_slot = slots[columns[slot]];
+        if (read_slot != slot) {
+            results[slot] = results[read_slot];
+            continue;
+        }
+
+        std::size_t count = 0;
+        for (const auto& chunk : chunks) {
+            count += chunk[slot].size();
+        }
+        results[slot].reserve(count);
+        for (const auto& chunk : chunks) {
+            results[slot].insert(results[slot].end(), chunk[slot].begin(), chunk[slot].end());
+        }
+    }
+
+    return true;
+}
+
+#endif // __PRECISED_FLOAT_CSV_H__
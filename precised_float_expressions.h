@@ -0,0 +1,407 @@
+#ifndef __PRECISED_FLOAT_EXPRESSIONS_H__
+#define __PRECISED_FLOAT_EXPRESSIONS_H__
+
+
+#include "precised_float.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+
+namespace precised_float_details {
+    // Value of an expression: a double-width two's complement integer at a magnitude order, so that sums go
+    // without branches on the signs and without checks of every step
+    template<typename Mantissa, typename Magnitude>
+    struct ExpressionTerm {
+        using p_float_t     = BasicPrecisedFloat<Mantissa, Magnitude>;
+        using mantissa_t    = Mantissa;
+        using magnitude_t   = Magnitude;
+        using state_t       = typename p_float_t::State;
+
+
+        static constexpr mantissa_t SIGN_BIT = mantissa_t{1} << (p_float_t::MANTISSA_DIGITS - 1);
+
+
+        static std::size_t magnitude_order_of(const p_float_t& p_float) noexcept {
+            return p_float.magnitude_order;
+        }
+
+        // <p_float> at <magnitude_order>, which is not smaller than its own
+        static ExpressionTerm from(const p_float_t& p_float, const std::size_t magnitude_order) noexcept {
+            return from(p_float.state, p_float.mantissa, p_float.magnitude_order, magnitude_order);
+        }
+
+        // BasicPrecisedFloat{<integer>} at <magnitude_order>
+        template<typename T>
+        static ExpressionTerm from_integer(const T integer, const std::size_t magnitude_order) noexcept {
+            mantissa_t mantissa = 0;
+            const bool fits = p_float_t::integer_to_mantissa(integer, mantissa);
+            const auto state = !fits ? state_t::NaN : integer < 0 ? state_t::NEGATIVE : state_t::POSITIVE;
+
+            return from(state, mantissa, 0, magnitude_order);
+        }
+
+        // <lhs> + <rhs>, or <lhs> - <rhs> when <is_subtraction>, at their common magnitude order
+        static ExpressionTerm add(const ExpressionTerm& lhs, ExpressionTerm rhs, const bool is_subtraction) noexcept {
+            rhs.negate_if(is_subtraction);
+
+            ExpressionTerm sum;
+            sum.magnitude_order = lhs.magnitude_order;
+            sum.low = lhs.low + rhs.low;
+            sum.high = lhs.high + rhs.high + (sum.low < rhs.low ? 1 : 0);
+            // Terms of the same sign overflow into the other one
+            const bool is_overflow = (~(lhs.high ^ rhs.high) & (lhs.high ^ sum.high) & SIGN_BIT) != 0;
+            sum.nan = lhs.nan || rhs.nan || is_overflow;
+            // A zero sum keeps the sign of <lhs> as operator+= and operator-= do
+            sum.is_negative = sum.is_zero() ? lhs.is_negative : sum.is_negative_value();
+
+            return sum;
+        }
+
+        static ExpressionTerm multiply(ExpressionTerm lhs, ExpressionTerm rhs) noexcept {
+            lhs.negate_if(lhs.is_negative_value());
+            rhs.negate_if(rhs.is_negative_value());
+            // A double-width factor goes to <lhs>, the product of two of them never fits
+            if (lhs.high == 0) {
+                std::swap(lhs, rhs);
+            }
+
+            ExpressionTerm product;
+            mantissa_t high_high = 0;
+            mantissa_t high_low = 0;
+            product.magnitude_order = lhs.magnitude_order + rhs.magnitude_order;
+            p_float_t::multiply_wide(lhs.low, rhs.low, product.high, product.low);
+            p_float_t::multiply_wide(lhs.high, rhs.low, high_high, high_low);
+            product.high += high_low;
+            product.is_negative = lhs.is_negative != rhs.is_negative;
+            product.nan = lhs.nan || rhs.nan || rhs.high != 0 || high_high != 0 || product.high < high_low || (product.high & SIGN_BIT) != 0;
+            product.negate_if(product.is_negative);
+
+            return product;
+        }
+
+        void scale_to(const std::size_t new_magnitude_order) noexcept {
+            const auto shift = new_magnitude_order - magnitude_order;
+            magnitude_order = new_magnitude_order;
+            if (shift == 0 || is_zero()) {
+                return;
+            } else if (shift >= p_float_t::RADIX_POWERS_COUNT) {
+                nan = true;
+                return;
+            }
+
+            const bool is_negative_term = is_negative_value();
+            negate_if(is_negative_term);
+
+            mantissa_t high_high = 0;
+            mantissa_t carry = 0;
+            p_float_t::multiply_wide(high, p_float_t::RADIX_POWERS[shift], high_high, high);
+            p_float_t::multiply_wide(low, p_float_t::RADIX_POWERS[shift], carry, low);
+            high += carry;
+            nan = nan || high_high != 0 || high < carry || (high & SIGN_BIT) != 0;
+
+            negate_if(is_negative_term);
+        }
+
+        // NaN when the magnitude does not fit into <mantissa_t>
+        p_float_t result() const noexcept {
+            auto magnitude = *this;
+            magnitude.negate_if(is_negative_value());
+            if (magnitude.nan || magnitude.high != 0 || magnitude_order > std::numeric_limits<magnitude_t>::max()) {
+                return p_float_t{};
+            }
+
+            return p_float_t{is_negative ? state_t::NEGATIVE : state_t::POSITIVE, static_cast<magnitude_t>(magnitude_order), magnitude.low};
+        }
+
+
+        mantissa_t  high               = 0;
+        mantissa_t  low                = 0;
+        std::size_t magnitude_order    = 0;
+        // The sign which operators give, a zero keeps it too
+        bool        is_negative        = false;
+        bool        nan                = false;
+
+    private:
+        static ExpressionTerm from(const state_t state, const mantissa_t mantissa, const std::size_t own_magnitude_order,
+                                   const std::size_t magnitude_order) noexcept {
+            ExpressionTerm term;
+            term.magnitude_order = own_magnitude_order;
+            term.low = mantissa;
+            term.is_negative = state == state_t::NEGATIVE;
+            term.nan = state == state_t::NaN;
+            term.scale_to(magnitude_order);
+            term.negate_if(term.is_negative);
+
+            return term;
+        }
+
+        bool is_zero() const noexcept {
+            return (high | low) == 0;
+        }
+
+        bool is_negative_value() const noexcept {
+            return (high & SIGN_BIT) != 0;
+        }
+
+        // Two's complement negation under a mask when <condition>
+        void negate_if(const bool condition) noexcept {
+            const auto mask = mantissa_t{0} - static_cast<mantissa_t>(condition);
+            // The smallest value is its own negation
+            nan = nan || (condition && high == SIGN_BIT && low == 0);
+            low = (low ^ mask) + (mask & 1);
+            high = (high ^ mask) + (low == 0 ? mask & 1 : 0);
+        }
+    };
+} // namespace precised_float_details
+
+
+// Opt-in expression templates. lazy(p_float) starts an expression, and operators +, - and * on expressions build
+// a tree instead of temporaries. The tree is evaluated once it converts to BasicPrecisedFloat: in one pass, at the
+// magnitude order of the whole expression chosen up front, with one overflow check at the end. Division and
+// floating point operands are evaluated by BasicPrecisedFloat as they are written.
+// The result is the same number in the same representation as with the operators of BasicPrecisedFloat when those
+// do not overflow. It is NaN only when an intermediate value does not fit into the double width or the result does
+// not fit into <mantissa_t>. Expressions refer to named operands and keep temporary ones by value, so an expression
+// stays valid as long as the named numbers in it. lazy() takes named numbers only
+namespace precised_float_expressions {
+    template<typename Derived, typename Mantissa, typename Magnitude>
+    class Expression {
+    public:
+        using p_float_t = BasicPrecisedFloat<Mantissa, Magnitude>;
+        using term_t    = precised_float_details::ExpressionTerm<Mantissa, Magnitude>;
+
+
+        p_float_t evaluate() const noexcept {
+            const auto& expression = static_cast<const Derived&>(*this);
+
+            return expression.evaluate_at(expression.magnitude_order()).result();
+        }
+
+        operator p_float_t() const noexcept {
+            return evaluate();
+        }
+    };
+
+
+    template<typename Mantissa, typename Magnitude>
+    class Reference : public Expression<Reference<Mantissa, Magnitude>, Mantissa, Magnitude> {
+        using base_t = Expression<Reference, Mantissa, Magnitude>;
+
+    public:
+        explicit Reference(const typename base_t::p_float_t& p_float) noexcept : p_float(p_float) {}
+
+        std::size_t magnitude_order() const noexcept {
+            return base_t::term_t::magnitude_order_of(p_float);
+        }
+
+        typename base_t::term_t evaluate_at(const std::size_t magnitude_order) const noexcept {
+            return base_t::term_t::from(p_float, magnitude_order);
+        }
+
+    private:
+        const typename base_t::p_float_t& p_float;
+    };
+
+    // An operand evaluated as it is written
+    template<typename Mantissa, typename Magnitude>
+    class Value : public Expression<Value<Mantissa, Magnitude>, Mantissa, Magnitude> {
+        using base_t = Expression<Value, Mantissa, Magnitude>;
+
+    public:
+        explicit Value(const typename base_t::p_float_t& p_float) noexcept : p_float(p_float) {}
+
+        std::size_t magnitude_order() const noexcept {
+            return base_t::term_t::magnitude_order_of(p_float);
+        }
+
+        typename base_t::term_t evaluate_at(const std::size_t magnitude_order) const noexcept {
+            return base_t::term_t::from(p_float, magnitude_order);
+        }
+
+    private:
+        typename base_t::p_float_t p_float;
+    };
+
+    template<typename Mantissa, typename Magnitude, typename T>
+    class Integer : public Expression<Integer<Mantissa, Magnitude, T>, Mantissa, Magnitude> {
+        using base_t = Expression<Integer, Mantissa, Magnitude>;
+
+    public:
+        explicit Integer(const T integer) noexcept : integer(integer) {}
+
+        std::size_t magnitude_order() const noexcept {
+            return 0;
+        }
+
+        typename base_t::term_t evaluate_at(const std::size_t magnitude_order) const noexcept {
+            return base_t::term_t::from_integer(integer, magnitude_order);
+        }
+
+    private:
+        T integer;
+    };
+
+    template<typename Lhs, typename Rhs, bool IS_SUBTRACTION>
+    class Sum : public Expression<Sum<Lhs, Rhs, IS_SUBTRACTION>, typename Lhs::p_float_t::mantissa_t, typename Lhs::p_float_t::magnitude_t> {
+        using base_t = Expression<Sum, typename Lhs::p_float_t::mantissa_t, typename Lhs::p_float_t::magnitude_t>;
+
+    public:
+        Sum(const Lhs& lhs, const Rhs& rhs) noexcept : lhs(lhs), rhs(rhs) {}
+
+        std::size_t magnitude_order() const noexcept {
+            return std::max(lhs.magnitude_order(), rhs.magnitude_order());
+        }
+
+        // Both operands go to the magnitude order of the enclosing sum at once
+        typename base_t::term_t evaluate_at(const std::size_t magnitude_order) const noexcept {
+            return base_t::term_t::add(lhs.evaluate_at(magnitude_order), rhs.evaluate_at(magnitude_order), IS_SUBTRACTION);
+        }
+
+    private:
+        Lhs lhs;
+        Rhs rhs;
+    };
+
+    template<typename Lhs, typename Rhs>
+    class Product : public Expression<Product<Lhs, Rhs>, typename Lhs::p_float_t::mantissa_t, typename Lhs::p_float_t::magnitude_t> {
+        using base_t = Expression<Product, typename Lhs::p_float_t::mantissa_t, typename Lhs::p_float_t::magnitude_t>;
+
+    public:
+        Product(const Lhs& lhs, const Rhs& rhs) noexcept : lhs(lhs), rhs(rhs) {}
+
+        std::size_t magnitude_order() const noexcept {
+            return lhs.magnitude_order() + rhs.magnitude_order();
+        }
+
+        typename base_t::term_t evaluate_at(const std::size_t magnitude_order) const noexcept {
+            auto product = base_t::term_t::multiply(lhs.evaluate_at(lhs.magnitude_order()), rhs.evaluate_at(rhs.magnitude_order()));
+            product.scale_to(magnitude_order);
+
+            return product;
+        }
+
+    private:
+        Lhs lhs;
+        Rhs rhs;
+    };
+
+
+    template<typename Mantissa, typename Magnitude>
+    Reference<Mantissa, Magnitude> lazy(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+        return Reference<Mantissa, Magnitude>{p_float};
+    }
+    template<typename Mantissa, typename Magnitude>
+    void lazy(BasicPrecisedFloat<Mantissa, Magnitude>&& p_float) = delete;
+
+
+    namespace details {
+        template<typename T, typename = void>
+        struct expression_p_float {
+            using type = void;
+        };
+
+        template<typename T>
+        struct expression_p_float<T, std::void_t<typename T::term_t>> {
+            using type = std::conditional_t<std::is_base_of_v<Expression<T, typename T::p_float_t::mantissa_t, typename T::p_float_t::magnitude_t>, T>,
+                                            typename T::p_float_t, void>;
+        };
+
+        template<typename T>
+        using expression_p_float_t = typename expression_p_float<T>::type;
+
+        template<typename T, typename PFloat>
+        constexpr bool is_operand_v = std::is_same_v<expression_p_float_t<T>, PFloat> || std::is_same_v<T, PFloat> ||
+                                      (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>);
+
+        // At least one of the operands is an expression and the other one fits it
+        template<typename Lhs, typename Rhs>
+        constexpr bool are_operands_v = (!std::is_void_v<expression_p_float_t<Lhs>> && is_operand_v<Rhs, expression_p_float_t<Lhs>>) ||
+                                        (!std::is_void_v<expression_p_float_t<Rhs>> && is_operand_v<Lhs, expression_p_float_t<Rhs>>);
+
+        template<typename Lhs, typename Rhs>
+        using enable_if_operands_t = typename std::enable_if<are_operands_v<Lhs, Rhs>, bool>::type;
+
+        template<typename Lhs, typename Rhs>
+        using operands_p_float_t = std::conditional_t<std::is_void_v<expression_p_float_t<Lhs>>, expression_p_float_t<Rhs>, expression_p_float_t<Lhs>>;
+
+        // Temporaries are kept by value, they end with the full expression which creates the expression
+        template<typename PFloat, typename T>
+        auto make_operand(T&& operand) noexcept {
+            using mantissa_t = typename PFloat::mantissa_t;
+            using magnitude_t = typename PFloat::magnitude_t;
+            using operand_t = std::remove_cvref_t<T>;
+
+            if constexpr (!std::is_void_v<expression_p_float_t<operand_t>>) {
+                return operand_t{std::forward<T>(operand)};
+            } else if constexpr (std::is_same_v<operand_t, PFloat> && std::is_lvalue_reference_v<T>) {
+                return Reference<mantissa_t, magnitude_t>{operand};
+            } else if constexpr (std::is_same_v<operand_t, PFloat>) {
+                return Value<mantissa_t, magnitude_t>{std::move(operand)};
+            } else if constexpr (std::is_integral_v<operand_t>) {
+                return Integer<mantissa_t, magnitude_t, operand_t>{operand};
+            } else {
+                return Value<mantissa_t, magnitude_t>{PFloat{operand}};
+            }
+        }
+
+        template<typename PFloat, typename T>
+        PFloat evaluate_operand(const T& operand) noexcept {
+            if constexpr (!std::is_void_v<expression_p_float_t<T>>) {
+                return operand.evaluate();
+            } else {
+                return PFloat{operand};
+            }
+        }
+    } // namespace details
+
+
+    template<typename Lhs, typename Rhs,
+             details::enable_if_operands_t<std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>> = true>
+    auto operator+(Lhs&& lhs, Rhs&& rhs) noexcept {
+        using p_float_t = details::operands_p_float_t<std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>>;
+
+        auto lhs_operand = details::make_operand<p_float_t>(std::forward<Lhs>(lhs));
+        auto rhs_operand = details::make_operand<p_float_t>(std::forward<Rhs>(rhs));
+
+        return Sum<decltype(lhs_operand), decltype(rhs_operand), false>{lhs_operand, rhs_operand};
+    }
+
+    template<typename Lhs, typename Rhs,
+             details::enable_if_operands_t<std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>> = true>
+    auto operator-(Lhs&& lhs, Rhs&& rhs) noexcept {
+        using p_float_t = details::operands_p_float_t<std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>>;
+
+        auto lhs_operand = details::make_operand<p_float_t>(std::forward<Lhs>(lhs));
+        auto rhs_operand = details::make_operand<p_float_t>(std::forward<Rhs>(rhs));
+
+        return Sum<decltype(lhs_operand), decltype(rhs_operand), true>{lhs_operand, rhs_operand};
+    }
+
+    template<typename Lhs, typename Rhs,
+             details::enable_if_operands_t<std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>> = true>
+    auto operator*(Lhs&& lhs, Rhs&& rhs) noexcept {
+        using p_float_t = details::operands_p_float_t<std::remove_cvref_t<Lhs>, std::remove_cvref_t<Rhs>>;
+
+        auto lhs_operand = details::make_operand<p_float_t>(std::forward<Lhs>(lhs));
+        auto rhs_operand = details::make_operand<p_float_t>(std::forward<Rhs>(rhs));
+
+        return Product<decltype(lhs_operand), decltype(rhs_operand)>{lhs_operand, rhs_operand};
+    }
+
+    // The quotient is evaluated by operator/ of BasicPrecisedFloat right away
+    template<typename Lhs, typename Rhs,
+             details::enable_if_operands_t<Lhs, Rhs> = true>
+    auto operator/(const Lhs& lhs, const Rhs& rhs) noexcept {
+        using p_float_t = details::operands_p_float_t<Lhs, Rhs>;
+
+        return Value<typename p_float_t::mantissa_t, typename p_float_t::magnitude_t>{
+            details::evaluate_operand<p_float_t>(lhs) / details::evaluate_operand<p_float_t>(rhs)
+        };
+    }
+} // namespace precised_float_expressions
+
+#endif // __PRECISED_FLOAT_EXPRESSIONS_H__
@@ -0,0 +1,202 @@
+#ifndef __PRECISED_FLOAT_FORMATTING_H__
+#define __PRECISED_FLOAT_FORMATTING_H__
+
+
+#include "precised_float_column.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <system_error>
+
+
+// Where format_batch() stopped: the end of the written text and the count of numbers in it
+struct FormatBatchResult {
+    char*          ptr;
+    std::size_t    count;
+};
+
+
+namespace precised_float_details {
+    // Writes numbers as their to_chars() text in lines of <numbers_per_line> numbers separated by a separator,
+    // every line ends with a line end. Zero numbers per line puts all numbers on one line
+    template<typename Mantissa, typename Magnitude>
+    class BatchFormatter {
+    public:
+        using p_float_t     = BasicPrecisedFloat<Mantissa, Magnitude>;
+        using column_t      = BasicPrecisedFloatColumn<Mantissa, Magnitude>;
+        using Kernels       = typename column_t::Kernels;
+
+
+        // The SIMD writer stores 16 bytes at once past the end of shorter numbers
+        static constexpr std::size_t SIMD_SLACK = 32;
+
+
+        // Every number is followed by one separator or line end
+        static std::size_t count_chars(const std::span<const p_float_t> p_floats) noexcept {
+            std::size_t count = 0;
+            for (const auto& p_float : p_floats) {
+                count += p_float.count_chars() + 1;
+            }
+
+            return count;
+        }
+
+        // Only whole lines are written, the numbers after the last one which fits are left for the next call
+        static FormatBatchResult format(const std::span<const p_float_t> p_floats, char* const first, char* const last, const char separator,
+                                        const std::size_t numbers_per_line, [[maybe_unused]] const Kernels kernels) noexcept {
+#if defined(PRECISED_FLOAT_COLUMN_X86_64)
+            if constexpr (SIMD_KERNELS) {
+                if (std::min(kernels, column_t::best_kernels()) != Kernels::SCALAR) {
+                    return format_lines<true>(p_floats, first, last, separator, numbers_per_line);
+                }
+            }
+#endif
+            return format_lines<false>(p_floats, first, last, separator, numbers_per_line);
+        }
+
+    private:
+        using State = typename p_float_t::State;
+
+
+        // The SIMD writer converts 16 digits, numbers with longer texts go to to_chars()
+        static constexpr bool SIMD_KERNELS = sizeof(Mantissa) == sizeof(std::uint64_t);
+        static constexpr std::uint64_t SIMD_MANTISSA_LIMIT = 100'000'000'000'000;
+        static constexpr std::size_t SIMD_MAGNITUDE_ORDER_LIMIT = 13;
+
+
+        template<bool Simd>
+        static FormatBatchResult format_lines(const std::span<const p_float_t> p_floats, char* const first, char* const last, const char separator,
+                                              const std::size_t numbers_per_line) noexcept {
+            const auto line_size = numbers_per_line != 0 ? numbers_per_line : p_floats.size();
+
+            FormatBatchResult result{first, 0};
+            auto position = first;
+            auto line_left = line_size;
+            for (std::size_t i = 0; i < p_floats.size(); ++i) {
+                const bool is_line_end = --line_left == 0 || i + 1 == p_floats.size();
+                const auto terminator = is_line_end ? '\n' : separator;
+#if defined(PRECISED_FLOAT_COLUMN_X86_64)
+                if constexpr (Simd) {
+                    position = write_avx2(p_floats[i], position, last, terminator);
+                } else {
+                    position = write(p_floats[i], position, last, terminator);
+                }
+#else
+                position = write(p_floats[i], position, last, terminator);
+#endif
+                if (position == nullptr) {
+                    break;
+                }
+                if (is_line_end) {
+                    result = {position, i + 1};
+                    line_left = line_size;
+                }
+            }
+
+            return result;
+        }
+
+        // Returns the end of the text after the terminator or nullptr when [<first>, <last>) is too short
+        static char* write(const p_float_t& p_float, char* const first, char* const last, const char terminator) noexcept {
+            const auto [end, error] = p_float.to_chars(first, last);
+            if (error != std::errc{} || end == last) {
+                return nullptr;
+            }
+
+            *end = terminator;
+            return end + 1;
+        }
+
+#if defined(PRECISED_FLOAT_COLUMN_X86_64)
+        // The mantissa becomes 16 digits with leading zeros, one shuffle takes the shown ones and opens a gap for the dot
+        // at the place magnitude_order gives
+        PRECISED_FLOAT_COLUMN_TARGET("avx2")
+        static char* write_avx2(const p_float_t& p_float, char* const first, char* const last, const char terminator) noexcept {
+            if (last - first < static_cast<std::ptrdiff_t>(SIMD_SLACK) || p_float.state == State::NaN ||
+                p_float.mantissa >= SIMD_MANTISSA_LIMIT || p_float.magnitude_order > SIMD_MAGNITUDE_ORDER_LIMIT) {
+                return write(p_float, first, last, terminator);
+            }
+
+            const auto digits = sixteen_digits(static_cast<std::uint64_t>(p_float.mantissa));
+
+            // At least one digit on each side of the dot, as to_chars() writes
+            const auto zero_bits = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(digits, _mm_setzero_si128())));
+            const auto digits_count = 16 - static_cast<std::size_t>(std::countr_zero((~zero_bits & 0xFFFF) | 0x8000));
+            const std::size_t magnitude_order = p_float.magnitude_order;
+            const auto integer_digits_count = digits_count > magnitude_order ? digits_count - magnitude_order : 1;
+            const auto fraction_digits_count = std::max<std::size_t>(magnitude_order, 1);
+
+            // Byte j comes from digit 16 - shown + j before the dot and from the one before it after the dot.
+            // With no fraction digits the byte after the dot comes from digit 16, which wraps to the leading zero
+            const auto positions = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            const auto dot_positions = _mm_set1_epi8(static_cast<char>(integer_digits_count));
+            auto sources = _mm_add_epi8(positions, _mm_set1_epi8(static_cast<char>(16 - integer_digits_count - magnitude_order)));
+            sources = _mm_add_epi8(sources, _mm_cmpgt_epi8(positions, dot_positions));
+            const auto chars = _mm_blendv_epi8(_mm_add_epi8(_mm_shuffle_epi8(digits, sources), _mm_set1_epi8('0')),
+                                               _mm_set1_epi8('.'), _mm_cmpeq_epi8(positions, dot_positions));
+
+            // The minus is written always and overwritten by the digits of a positive number
+            *first = '-';
+            const auto number_first = first + (p_float.state == State::NEGATIVE ? 1 : 0);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(number_first), chars);
+
+            const auto end = number_first + integer_digits_count + 1 + fraction_digits_count;
+            *end = terminator;
+            return end + 1;
+        }
+
+        // Digits of <value> below 10^16 in 16 bytes, the highest first. Every 4-digit quarter abcd goes to four 16-bit lanes,
+        // which are divided by 1000, 100, 10 and 1 as fixed point multiplications into a, ab, abc and abcd,
+        // then every quotient minus 10 times the one before it is a digit
+        PRECISED_FLOAT_COLUMN_TARGET("avx2")
+        static __m128i sixteen_digits(const std::uint64_t value) noexcept {
+            const auto halves = _mm_set_epi64x(static_cast<long long>(value % 100'000'000), static_cast<long long>(value / 100'000'000));
+            // Both halves / 10000 as half * ceil(2^45 / 10000) >> 45
+            const auto high_quarters = _mm_srli_epi64(_mm_mul_epu32(halves, _mm_set1_epi32(static_cast<int>(0xD1B71759))), 45);
+            const auto low_quarters = _mm_sub_epi32(halves, _mm_mul_epu32(high_quarters, _mm_set1_epi32(10000)));
+            // The four quarters times 4 for the fixed point below, one in every 32-bit lane
+            const auto quarters = _mm_slli_epi32(_mm_or_si128(high_quarters, _mm_slli_epi64(low_quarters, 32)), 2);
+
+            const auto repeated = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(quarters),
+                                                      _mm256_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 4, 5, 4, 5, 4, 5, 4, 5,
+                                                                       8, 9, 8, 9, 8, 9, 8, 9, 12, 13, 12, 13, 12, 13, 12, 13));
+            const auto quotients = _mm256_mulhi_epu16(_mm256_mulhi_epu16(repeated, _mm256_setr_epi16(8389, 5243, 13108, -32768, 8389, 5243, 13108, -32768,
+                                                                                                     8389, 5243, 13108, -32768, 8389, 5243, 13108, -32768)),
+                                                      _mm256_setr_epi16(1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768,
+                                                                        1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768));
+            const auto digits = _mm256_sub_epi16(quotients, _mm256_slli_epi64(_mm256_mullo_epi16(quotients, _mm256_set1_epi16(10)), 16));
+
+            return _mm_packus_epi16(_mm256_castsi256_si128(digits), _mm256_extracti128_si256(digits, 1));
+        }
+#endif
+    };
+} // namespace precised_float_details
+
+
+// Writes <p_floats> into [first, last) in lines of <numbers_per_line> numbers separated by <separator>, zero puts all of them
+// on one line. Every line ends with '\n' and every number is written as to_chars() writes it. Only whole lines are written:
+// when the buffer is too short the result points past the last line which fits and tells how many numbers it holds
+template<typename Mantissa, typename Magnitude>
+FormatBatchResult format_batch(std::span<const BasicPrecisedFloat<Mantissa, Magnitude>> p_floats, char* const first, char* const last,
+                               const char separator = ',', const std::size_t numbers_per_line = 1,
+                               const typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Kernels kernels = BasicPrecisedFloatColumn<Mantissa, Magnitude>::best_kernels()) noexcept {
+    return precised_float_details::BatchFormatter<Mantissa, Magnitude>::format(p_floats, first, last, separator, numbers_per_line, kernels);
+}
+
+template<typename Mantissa, typename Magnitude>
+std::string format_batch(std::span<const BasicPrecisedFloat<Mantissa, Magnitude>> p_floats, const char separator = ',', const std::size_t numbers_per_line = 1,
+                         const typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Kernels kernels = BasicPrecisedFloatColumn<Mantissa, Magnitude>::best_kernels()) {
+    using formatter_t = precised_float_details::BatchFormatter<Mantissa, Magnitude>;
+
+    std::string text(formatter_t::count_chars(p_floats) + formatter_t::SIMD_SLACK, '\0');
+    const auto result = formatter_t::format(p_floats, text.data(), text.data() + text.size(), separator, numbers_per_line, kernels);
+    text.resize(static_cast<std::size_t>(result.ptr - text.data()));
+
+    return text;
+}
+
+#endif // __PRECISED_FLOAT_FORMATTING_H__
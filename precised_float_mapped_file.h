@@ -0,0 +1,117 @@
+#ifndef __PRECISED_FLOAT_MAPPED_FILE_H__
+#define __PRECISED_FLOAT_MAPPED_FILE_H__
+
+
+#include <cstddef>
+#include <string_view>
+
+#if defined(_WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace precised_float_details {
+    // A whole file mapped read-only into memory
+    class MappedFile {
+    public:
+        // Read ahead for files read through, on demand for files of which only some parts are read
+        enum class Access {
+            SEQUENTIAL,
+            RANDOM
+        };
+
+
+        explicit MappedFile(const char* const path, const Access access = Access::SEQUENTIAL) noexcept {
+#if defined(_WIN32)
+            file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                 access == Access::SEQUENTIAL ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS, nullptr);
+            LARGE_INTEGER file_size{};
+            if (file == INVALID_HANDLE_VALUE || !::GetFileSizeEx(file, &file_size)) {
+                return;
+            }
+
+            // An empty file cannot be mapped, but it is read fine
+            size = static_cast<std::size_t>(file_size.QuadPart);
+            if (size != 0) {
+                mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                data = mapping != nullptr ? static_cast<const char*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+            }
+#else
+            const auto descriptor = ::open(path, O_RDONLY);
+            if (descriptor < 0) {
+                return;
+            }
+
+            struct stat status{};
+            if (::fstat(descriptor, &status) != 0) {
+                ::close(descriptor);
+                return;
+            }
+
+            // The mapping outlives the descriptor, an empty file cannot be mapped, but it is read fine
+            size = static_cast<std::size_t>(status.st_size);
+            if (size != 0) {
+                const auto mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (mapped != MAP_FAILED) {
+                    ::madvise(mapped, size, access == Access::SEQUENTIAL ? MADV_WILLNEED : MADV_RANDOM);
+                    data = static_cast<const char*>(mapped);
+                }
+            }
+            ::close(descriptor);
+#endif
+            is_mapped = size == 0 || data != nullptr;
+        }
+
+        ~MappedFile() {
+#if defined(_WIN32)
+            if (data != nullptr) {
+                ::UnmapViewOfFile(data);
+            }
+            if (mapping != nullptr) {
+                ::CloseHandle(mapping);
+            }
+            if (file != INVALID_HANDLE_VALUE) {
+                ::CloseHandle(file);
+            }
+#else
+            if (data != nullptr) {
+                ::munmap(const_cast<char*>(data), size);
+            }
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+
+        bool is_open() const noexcept {
+            return is_mapped;
+        }
+
+        std::string_view text() const noexcept {
+            return is_mapped ? std::string_view{data, size} : std::string_view{};
+        }
+
+    private:
+        const char*    data         = nullptr;
+        std::size_t    size         = 0;
+        bool           is_mapped    = false;
+#if defined(_WIN32)
+        HANDLE         file         = INVALID_HANDLE_VALUE;
+        HANDLE         mapping      = nullptr;
+#endif
+    };
+} // namespace precised_float_details
+
+#endif // __PRECISED_FLOAT_MAPPED_FILE_H__
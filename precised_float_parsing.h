@@ -0,0 +1,372 @@
+#ifndef __PRECISED_FLOAT_PARSING_H__
+#define __PRECISED_FLOAT_PARSING_H__
+
+
+#include "precised_float_column.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+
+namespace precised_float_details {
+    // Splits text into fields and parses every field as the string constructor does
+    template<typename Mantissa, typename Magnitude>
+    class BatchParser {
+    public:
+        using p_float_t     = BasicPrecisedFloat<Mantissa, Magnitude>;
+        using column_t      = BasicPrecisedFloatColumn<Mantissa, Magnitude>;
+        using Kernels       = typename column_t::Kernels;
+
+
+        // <kernels> narrowed to the ones the processor and the mantissa type allow, AVX512 parses as AVX2
+        static Kernels available_kernels(const Kernels kernels) noexcept {
+            if constexpr (SIMD_KERNELS) {
+                return std::min(std::min(kernels, column_t::best_kernels()), Kernels::AVX2);
+            } else {
+                return Kernels::SCALAR;
+            }
+        }
+
+        // <on_field>(field, is_line_end) gets every field of <text> in order, returns the count of fields
+        template<typename OnField>
+        static std::size_t split(const std::string_view text, const char separator, const Kernels kernels, const OnField& on_field) {
+            return split_fields<false>(text, separator, kernels, on_field);
+        }
+
+        // <number> lies in text which ends at <text_last>, <kernels> come from available_kernels()
+        static p_float_t parse_field(const std::string_view number, [[maybe_unused]] const char* const text_last, [[maybe_unused]] const Kernels kernels) noexcept {
+#if defined(PRECISED_FLOAT_COLUMN_X86_64)
+            if constexpr (SIMD_KERNELS) {
+                if (kernels != Kernels::SCALAR) {
+                    return parse_field_avx2(number, text_last);
+                }
+            }
+#endif
+            return p_float_t{number};
+        }
+
+        // <sink>(p_float) gets the numbers in the order of the fields, returns the count of fields
+        template<typename Sink>
+        static std::size_t parse(const std::string_view text, const char separator, const Kernels kernels, const Sink& sink) {
+            return split_fields<true>(text, separator, kernels, [&sink](const p_float_t& p_float, bool) {
+                sink(p_float);
+            });
+        }
+
+    private:
+        using State = typename p_float_t::State;
+
+
+        // The SIMD field parser converts up to 16 digits, which always fit a 64-bit mantissa
+        static constexpr bool SIMD_KERNELS = sizeof(Mantissa) == sizeof(std::uint64_t);
+        static constexpr std::size_t SIMD_FIELD_LENGTH = 16;
+
+
+        // A carriage return before the separator is a part of a CRLF line end, not of the number
+        static std::string_view field(const char* const first, const char* last) noexcept {
+            if (last != first && *(last - 1) == '\r') {
+                --last;
+            }
+
+            return std::string_view{first, static_cast<std::size_t>(last - first)};
+        }
+
+        // With <ParseFields> <on_field> gets the numbers instead of the fields, the SIMD field parsers run in the splitting loop then
+        template<bool ParseFields, typename OnField>
+        static std::size_t split_fields(const std::string_view text, const char separator, [[maybe_unused]] const Kernels kernels, const OnField& on_field) {
+#if defined(PRECISED_FLOAT_COLUMN_X86_64)
+            if (available_kernels(kernels) != Kernels::SCALAR) {
+                return split_avx2<ParseFields>(text, separator, on_field);
+            }
+#endif
+            return split_scalar<ParseFields>(text, separator, on_field);
+        }
+
+        template<bool ParseFields, typename OnField>
+        static std::size_t split_scalar(const std::string_view text, const char separator, const OnField& on_field) {
+            const auto emit = [&on_field](const std::string_view number, const bool is_line_end) {
+                if constexpr (ParseFields) {
+                    on_field(p_float_t{number}, is_line_end);
+                } else {
+                    on_field(number, is_line_end);
+                }
+            };
+
+            std::size_t count = 0;
+            auto field_first = text.data();
+            for (auto current = text.data(); current != text.data() + text.size(); ++current) {
+                if (*current == separator || *current == '\n') {
+                    emit(field(field_first, current), *current == '\n');
+                    field_first = current + 1;
+                    ++count;
+                }
+            }
+            // The end of the text ends the last field as a line end does, also an empty one after a separator
+            if (!text.empty() && text.back() != '\n') {
+                emit(field(field_first, text.data() + text.size()), true);
+                ++count;
+            }
+
+            return count;
+        }
+
+#if defined(PRECISED_FLOAT_COLUMN_X86_64)
+        // Separators are found 64 bytes at a time as bit masks
+        template<bool ParseFields, typename OnField>
+        PRECISED_FLOAT_COLUMN_TARGET("avx2")
+        static std::size_t split_avx2(const std::string_view text, const char separator, const OnField& on_field) {
+            constexpr std::size_t BLOCK_SIZE = 64;
+
+            const auto text_last = text.data() + text.size();
+            const auto separators = _mm256_set1_epi8(separator);
+            const auto newlines = _mm256_set1_epi8('\n');
+
+            std::size_t count = 0;
+            auto field_first = text.data();
+            [[maybe_unused]] FieldPairs pair_fields;
+            // A last field without a line end after it ends at a separator bit one past the text, also an empty one after a separator
+            const bool is_last_field_open = !text.empty() && text.back() != '\n';
+            for (std::size_t block = 0; block < text.size() + is_last_field_open; block += BLOCK_SIZE) {
+                std::uint64_t bits = 0;
+                if (block + BLOCK_SIZE <= text.size()) {
+                    const auto low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + block));
+                    const auto high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + block + BLOCK_SIZE / 2));
+                    const auto low_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(low, separators),
+                                                                                                          _mm256_cmpeq_epi8(low, newlines))));
+                    const auto high_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(high, separators),
+                                                                                                           _mm256_cmpeq_epi8(high, newlines))));
+                    bits = std::uint64_t{high_bits} << 32 | low_bits;
+                } else {
+                    for (auto i = block; i < text.size(); ++i) {
+                        bits |= std::uint64_t{text[i] == separator || text[i] == '\n'} << (i - block);
+                    }
+                    bits |= std::uint64_t{is_last_field_open} << (text.size() - block);
+                }
+
+                for (; bits != 0; bits &= bits - 1) {
+                    const auto field_last = text.data() + block + std::countr_zero(bits);
+                    const bool is_line_end = field_last == text_last || *field_last == '\n';
+                    if constexpr (ParseFields) {
+                        pair_fields.push(field(field_first, field_last), is_line_end, text_last, on_field);
+                    } else {
+                        on_field(field(field_first, field_last), is_line_end);
+                    }
+                    field_first = field_last + 1;
+                    ++count;
+                }
+            }
+            if constexpr (ParseFields) {
+                pair_fields.flush(text_last, on_field);
+            }
+
+            return count;
+        }
+
+        // Fields the SIMD parser takes wait in pairs for parse_fields_avx2(), the others flush the waiting one first
+        struct FieldPairs {
+            std::string_view number;
+            bool is_line_end = false;
+            bool is_waiting = false;
+
+            template<typename OnField>
+            PRECISED_FLOAT_COLUMN_TARGET("avx2")
+            void push(const std::string_view next_number, const bool next_is_line_end, const char* const text_last, const OnField& on_field) {
+                if (next_number.size() > SIMD_FIELD_LENGTH || text_last - next_number.data() < static_cast<std::ptrdiff_t>(SIMD_FIELD_LENGTH)) {
+                    flush(text_last, on_field);
+                    on_field(parse_field_avx2(next_number, text_last), next_is_line_end);
+                } else if (is_waiting) {
+                    const auto p_floats = parse_fields_avx2(number, next_number);
+                    on_field(p_floats[0], is_line_end);
+                    on_field(p_floats[1], next_is_line_end);
+                    is_waiting = false;
+                } else {
+                    number = next_number;
+                    is_line_end = next_is_line_end;
+                    is_waiting = true;
+                }
+            }
+
+            template<typename OnField>
+            PRECISED_FLOAT_COLUMN_TARGET("avx2")
+            void flush(const char* const text_last, const OnField& on_field) {
+                if (is_waiting) {
+                    on_field(parse_field_avx2(number, text_last), is_line_end);
+                    is_waiting = false;
+                }
+            }
+        };
+
+        // Fields longer than the SIMD parser takes go to the string constructor,
+        // fields too close to <text_last> for a 16-byte load are copied out first
+        PRECISED_FLOAT_COLUMN_TARGET("avx2")
+        static p_float_t parse_field_avx2(const std::string_view number, const char* const text_last) noexcept {
+            if (number.size() > SIMD_FIELD_LENGTH) {
+                return p_float_t{number};
+            }
+            auto chars = number.data();
+            char buffer[SIMD_FIELD_LENGTH]{};
+            if (text_last - number.data() < static_cast<std::ptrdiff_t>(SIMD_FIELD_LENGTH)) {
+                std::memcpy(buffer, number.data(), number.size());
+                chars = buffer;
+            }
+
+            return parse_field_sse(chars, number.size());
+        }
+
+        // [<first>, <first> + <length>) is the field, 16 bytes from <first> are readable.
+        // The digits are moved to the end of the register without the dot and converted 2, 4, 8 and 16 at a time
+        PRECISED_FLOAT_COLUMN_TARGET("avx2")
+        static p_float_t parse_field_sse(const char* const first, const std::size_t length) noexcept {
+            const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            const auto digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+
+            const auto field_bits = (1u << length) - 1;
+            const auto digit_bits = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits))) & field_bits;
+            const auto dot_bits = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('.')))) & field_bits;
+            const auto zero_bits = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('0')))) & field_bits;
+            const auto minus_bits = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('-')))) & field_bits;
+
+            // An optional minus, a digit, more digits and at most one dot followed by a digit
+            const auto start = minus_bits & 1;
+            const bool is_valid = (length > start) & ((digit_bits >> start & 1) != 0) & ((digit_bits | dot_bits) == (field_bits >> start << start)) &
+                                  ((dot_bits & (dot_bits - 1)) == 0) & ((dot_bits == 0) | ((digit_bits & (dot_bits << 1)) != 0));
+
+            // Trailing zeros of the fraction are dropped, the dot stops them and goes too when nothing is left after it.
+            // The bits above the dot are 0 - (dot_bits << 1), or none without a dot
+            const auto dot = static_cast<unsigned>(std::countr_zero(dot_bits));
+            const auto fraction_zero_bits = zero_bits & (0u - (dot_bits << 1));
+            auto last = static_cast<unsigned>(std::bit_width((field_bits & ~fraction_zero_bits) | 1));
+            last -= last == dot + 1;
+            const bool has_fraction = dot < last;
+            const auto integer_digits_count = (has_fraction ? dot : last) - start;
+            const auto digits_count = last - start - has_fraction;
+
+            // Digit t of the number goes to byte 16 - digits_count + t, bytes before the number are zeros
+            const auto positions = _mm_sub_epi8(_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                                                _mm_set1_epi8(static_cast<char>(SIMD_FIELD_LENGTH - digits_count)));
+            // Digits after the integer ones come from one byte further, past the dot
+            auto sources = _mm_add_epi8(positions, _mm_set1_epi8(static_cast<char>(start)));
+            sources = _mm_sub_epi8(sources, _mm_cmpgt_epi8(positions, _mm_set1_epi8(static_cast<char>(integer_digits_count - 1))));
+            sources = _mm_or_si128(sources, _mm_cmpgt_epi8(_mm_setzero_si128(), positions));
+            const auto ordered_digits = _mm_shuffle_epi8(digits, sources);
+
+            const auto pairs = _mm_maddubs_epi16(ordered_digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+            const auto quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+            const auto packed_quads = _mm_packus_epi32(quads, quads);
+            const auto octets = _mm_madd_epi16(packed_quads, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+            const auto high_octet = static_cast<std::uint32_t>(_mm_cvtsi128_si32(octets));
+            const auto low_octet = static_cast<std::uint32_t>(_mm_extract_epi32(octets, 1));
+
+            // NaN is -1, NEGATIVE 0 and POSITIVE 1, a NaN gets a zero mantissa and order
+            const auto valid_mask = std::uint64_t{0} - is_valid;
+            return p_float_t{static_cast<State>(static_cast<int>(is_valid) * (2 - static_cast<int>(start)) - 1),
+                             static_cast<typename p_float_t::magnitude_t>((last - dot - 1) & (0u - has_fraction) & valid_mask),
+                             static_cast<typename p_float_t::mantissa_t>((std::uint64_t{high_octet} * 100'000'000 + low_octet) & valid_mask)};
+        }
+
+        // The multiplicative inverses of 5^k modulo 2^64, (m * 10^k >> k) * INVERSE_POWERS_OF_5[k] is m
+        static constexpr auto INVERSE_POWERS_OF_5 = [] {
+            std::array<std::uint64_t, SIMD_FIELD_LENGTH + 1> inverses{1};
+            for (std::size_t k = 1; k < inverses.size(); ++k) {
+                inverses[k] = inverses[k - 1] * 0xCCCC'CCCC'CCCC'CCCDull;
+            }
+            return inverses;
+        }();
+
+        // Both fields are at most 16 bytes long, 16 bytes from each first byte are readable.
+        // Every field takes one 128-bit lane, so the validation, the dropped dot and the conversion run once for both:
+        // the digits stay where they are, from the minus (a leading zero) onwards, with the fraction moved over the dot.
+        // That is the number times 10^k for the bytes after it, the exact division by 10^k drops them and the trailing
+        // zeros of the fraction
+        PRECISED_FLOAT_COLUMN_TARGET("avx2")
+        static std::array<p_float_t, 2> parse_fields_avx2(const std::string_view number_0, const std::string_view number_1) noexcept {
+            const auto indexes = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                                  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            const auto chars = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(number_0.data()))),
+                                                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(number_1.data())), 1);
+            const auto lengths = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi8(static_cast<char>(number_0.size()))),
+                                                         _mm_set1_epi8(static_cast<char>(number_1.size())), 1);
+            const auto field_bytes = _mm256_cmpgt_epi8(lengths, indexes);
+            const auto digits = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+
+            const auto digit_bytes = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits), field_bytes);
+            const auto dot_bytes = _mm256_and_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('.')), field_bytes);
+            const auto minus_bytes = _mm256_and_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('-')), _mm256_and_si256(_mm256_cmpeq_epi8(indexes, _mm256_setzero_si256()), field_bytes));
+            // The bytes from the first dot onwards, the ones after it may not be dots
+            auto fraction_bytes = _mm256_or_si256(dot_bytes, _mm256_slli_si256(dot_bytes, 1));
+            fraction_bytes = _mm256_or_si256(fraction_bytes, _mm256_slli_si256(fraction_bytes, 2));
+            fraction_bytes = _mm256_or_si256(fraction_bytes, _mm256_slli_si256(fraction_bytes, 4));
+            fraction_bytes = _mm256_or_si256(fraction_bytes, _mm256_slli_si256(fraction_bytes, 8));
+            const auto allowed_bytes = _mm256_or_si256(_mm256_or_si256(digit_bytes, minus_bytes), _mm256_andnot_si256(_mm256_slli_si256(fraction_bytes, 1), dot_bytes));
+
+            const auto kept_digits = _mm256_and_si256(digits, digit_bytes);
+            const auto ordered_digits = _mm256_blendv_epi8(kept_digits, _mm256_srli_si256(kept_digits, 1), fraction_bytes);
+            const auto pairs = _mm256_maddubs_epi16(ordered_digits, _mm256_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1,
+                                                                                     10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+            const auto quads = _mm256_madd_epi16(pairs, _mm256_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1, 100, 1, 100, 1, 100, 1, 100, 1));
+            const auto packed_quads = _mm256_packus_epi32(quads, quads);
+            const auto octets = _mm256_madd_epi16(packed_quads, _mm256_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1, 10000, 1, 10000, 1, 10000, 1, 10000, 1));
+            const auto scaled = _mm256_add_epi64(_mm256_mul_epu32(octets, _mm256_set1_epi64x(100'000'000)), _mm256_srli_epi64(octets, 32));
+
+            // Bits 0-15 are the bytes of the first field, bits 16-31 the ones of the second.
+            // A digit first after an optional minus, only allowed bytes and a digit after every dot
+            const auto digit_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(digit_bytes));
+            const auto dot_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(dot_bytes));
+            const auto minus_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(minus_bytes));
+            const auto field_bits = ((1u << number_0.size()) - 1) | ((1u << number_1.size()) - 1) << 16;
+            const auto zero_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(digits, _mm256_setzero_si256()))) & field_bits;
+            const auto invalid_bits = (field_bits & ~static_cast<std::uint32_t>(_mm256_movemask_epi8(allowed_bytes))) |
+                                      ((0x0001'0001u + minus_bits) & ~digit_bits) | (dot_bits << 1 & ~digit_bits & 0xFFFE'FFFEu) | (dot_bits & 0x8000'8000u);
+
+            const auto convert = [](const unsigned length, const unsigned invalid, const unsigned dots, const unsigned minus, const unsigned zeros,
+                                    const std::uint64_t scaled_mantissa) noexcept {
+                const bool is_valid = invalid == 0;
+                const bool has_dot = dots != 0;
+                const auto fraction_length = (length - static_cast<unsigned>(std::countr_zero(dots)) - 1) & (0u - has_dot);
+                const auto trailing_zeros = std::min(length - static_cast<unsigned>(std::bit_width(((1u << length) - 1) & ~zeros)), fraction_length);
+                const auto divisor_order = SIMD_FIELD_LENGTH - length + has_dot + trailing_zeros;
+
+                // NaN is -1, NEGATIVE 0 and POSITIVE 1, a NaN gets a zero mantissa and order
+                const auto valid_mask = std::uint64_t{0} - is_valid;
+                return p_float_t{static_cast<State>(static_cast<int>(is_valid) * (2 - static_cast<int>(minus)) - 1),
+                                 static_cast<typename p_float_t::magnitude_t>((fraction_length - trailing_zeros) & valid_mask),
+                                 static_cast<typename p_float_t::mantissa_t>(((scaled_mantissa >> divisor_order) * INVERSE_POWERS_OF_5[divisor_order]) & valid_mask)};
+            };
+
+            return {convert(static_cast<unsigned>(number_0.size()), invalid_bits & 0xFFFF, dot_bits & 0xFFFF, minus_bits & 1, zero_bits & 0xFFFF,
+                            static_cast<std::uint64_t>(_mm256_extract_epi64(scaled, 0))),
+                    convert(static_cast<unsigned>(number_1.size()), invalid_bits >> 16, dot_bits >> 16, minus_bits >> 16, zero_bits >> 16,
+                            static_cast<std::uint64_t>(_mm256_extract_epi64(scaled, 2)))};
+        }
+#endif
+    };
+} // namespace precised_float_details
+
+
+// Parses <text> of numbers separated by <separator> or by line ends and appends them to <p_floats>,
+// returns the count of appended numbers. Every field gives what the string constructor gives for it:
+// malformed and empty fields are NaN. A carriage return at the end of a field is dropped for CRLF line ends.
+// The end of <text> ends the last line: a line end before it does not start one more field, a separator does
+template<typename Mantissa, typename Magnitude>
+std::size_t parse_batch(const std::string_view text, std::vector<BasicPrecisedFloat<Mantissa, Magnitude>>& p_floats, const char separator = ',',
+                        const typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Kernels kernels = BasicPrecisedFloatColumn<Mantissa, Magnitude>::best_kernels()) {
+    return precised_float_details::BatchParser<Mantissa, Magnitude>::parse(text, separator, kernels, [&p_floats](const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) {
+        p_floats.push_back(p_float);
+    });
+}
+
+template<typename Mantissa, typename Magnitude>
+std::size_t parse_batch(const std::string_view text, BasicPrecisedFloatColumn<Mantissa, Magnitude>& column, const char separator = ',',
+                        const typename BasicPrecisedFloatColumn<Mantissa, Magnitude>::Kernels kernels = BasicPrecisedFloatColumn<Mantissa, Magnitude>::best_kernels()) {
+    return precised_float_details::BatchParser<Mantissa, Magnitude>::parse(text, separator, kernels, [&column](const BasicPrecisedFloat<Mantissa, Magnitude>& p_float) {
+        column.push_back(p_float);
+    });
+}
+
+#endif // __PRECISED_FLOAT_PARSING_H__
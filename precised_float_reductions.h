@@ -0,0 +1,152 @@
+#ifndef __PRECISED_FLOAT_REDUCTIONS_H__
+#define __PRECISED_FLOAT_REDUCTIONS_H__
+
+
+#include "precised_float.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace precised_float_details {
+    // Shorter chunks cost more to start a thread for than to reduce
+    inline constexpr std::size_t MIN_CHUNK_SIZE = 1 << 14;
+
+    // <reduce>(first, last) of consecutive chunks of [0, <count>) on up to <threads_count> threads, 0 is one per core.
+    // The results go in the order of the chunks, so that combining them does not depend on the scheduling
+    template<typename Reduce>
+    auto reduce_chunks(const std::size_t count, unsigned threads_count, const Reduce& reduce) {
+        if (threads_count == 0) {
+            threads_count = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        const auto chunks_count = std::max<std::size_t>(std::min<std::size_t>(threads_count, count / MIN_CHUNK_SIZE), 1);
+        const auto chunk_size = (count + chunks_count - 1) / chunks_count;
+
+        std::vector<decltype(reduce(std::size_t{}, std::size_t{}))> results(chunks_count);
+        std::vector<std::jthread> threads;
+        threads.reserve(chunks_count - 1);
+        for (std::size_t chunk = 1; chunk < chunks_count; ++chunk) {
+            threads.emplace_back([&reduce, &results, chunk, chunk_size, count] {
+                results[chunk] = reduce(chunk * chunk_size, std::min(count, (chunk + 1) * chunk_size));
+            });
+        }
+        results[0] = reduce(0, std::min(count, chunk_size));
+        threads.clear();
+
+        return results;
+    }
+} // namespace precised_float_details
+
+
+// Reductions which split the range across threads. Every chunk is reduced exactly and the partial results are
+// combined in the order of the chunks, so that the results are the same for any <threads_count>.
+// <threads_count> 0 is one thread per core. NaN anywhere in the range makes the result NaN
+
+
+// The exact sum without trailing fraction zeros, see BasicPrecisedFloat::Accumulator::result()
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloat<Mantissa, Magnitude> reduce_sum(std::span<const BasicPrecisedFloat<Mantissa, Magnitude>> p_floats, const unsigned threads_count = 0) {
+    using accumulator_t = typename BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator;
+
+    const auto accumulators = precised_float_details::reduce_chunks(p_floats.size(), threads_count, [p_floats](const std::size_t first, const std::size_t last) {
+        accumulator_t accumulator;
+        accumulator.add(p_floats.subspan(first, last - first));
+
+        return accumulator;
+    });
+
+    accumulator_t sum;
+    for (const auto& accumulator : accumulators) {
+        sum.merge(accumulator);
+    }
+
+    return sum.result();
+}
+
+
+// The first of the smallest numbers and the last of the biggest ones, as std::minmax_element() finds them.
+// Both are NaN for an empty range
+template<typename Mantissa, typename Magnitude>
+std::pair<BasicPrecisedFloat<Mantissa, Magnitude>, BasicPrecisedFloat<Mantissa, Magnitude>> reduce_minmax(std::span<const BasicPrecisedFloat<Mantissa, Magnitude>> p_floats, const unsigned threads_count = 0) {
+    using p_float_t = BasicPrecisedFloat<Mantissa, Magnitude>;
+    using minmax_t = std::pair<p_float_t, p_float_t>;
+
+    if (p_floats.empty()) {
+        return minmax_t{};
+    }
+
+    const auto minmaxes = precised_float_details::reduce_chunks(p_floats.size(), threads_count, [p_floats](const std::size_t first, const std::size_t last) {
+        minmax_t minmax{p_floats[first], p_floats[first]};
+        for (auto i = first; i < last && !minmax.first.is_nan(); ++i) {
+            if (p_floats[i].is_nan()) {
+                minmax = minmax_t{};
+            } else if (p_floats[i] < minmax.first) {
+                minmax.first = p_floats[i];
+            } else if (p_floats[i] >= minmax.second) {
+                minmax.second = p_floats[i];
+            }
+        }
+
+        return minmax;
+    });
+
+    auto result = minmaxes.front();
+    for (const auto& minmax : std::span{minmaxes}.subspan(1)) {
+        if (result.first.is_nan() || minmax.first.is_nan()) {
+            return minmax_t{};
+        }
+
+        if (minmax.first < result.first) {
+            result.first = minmax.first;
+        }
+        if (minmax.second >= result.second) {
+            result.second = minmax.second;
+        }
+    }
+
+    return result;
+}
+
+
+// reduce_sum() divided by the count of numbers, NaN for an empty range
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloat<Mantissa, Magnitude> mean(std::span<const BasicPrecisedFloat<Mantissa, Magnitude>> p_floats, const unsigned threads_count = 0) {
+    using p_float_t = BasicPrecisedFloat<Mantissa, Magnitude>;
+
+    if (p_floats.empty()) {
+        return p_float_t{};
+    }
+
+    return reduce_sum(p_floats, threads_count) / p_float_t{p_floats.size()};
+}
+
+
+// The exact sum of min(lhs.size(), rhs.size()) products, which do not overflow as operator*= does
+template<typename Mantissa, typename Magnitude>
+BasicPrecisedFloat<Mantissa, Magnitude> dot(std::span<const BasicPrecisedFloat<Mantissa, Magnitude>> lhs, std::span<const BasicPrecisedFloat<Mantissa, Magnitude>> rhs, const unsigned threads_count = 0) {
+    using accumulator_t = typename BasicPrecisedFloat<Mantissa, Magnitude>::Accumulator;
+
+    const auto count = std::min(lhs.size(), rhs.size());
+    const auto accumulators = precised_float_details::reduce_chunks(count, threads_count, [lhs, rhs](const std::size_t first, const std::size_t last) {
+        accumulator_t accumulator;
+        for (auto i = first; i < last; ++i) {
+            accumulator.add_product(lhs[i], rhs[i]);
+        }
+
+        return accumulator;
+    });
+
+    accumulator_t sum;
+    for (const auto& accumulator : accumulators) {
+        sum.merge(accumulator);
+    }
+
+    return sum.result();
+}
+
+#endif // __PRECISED_FLOAT_REDUCTIONS_H__
@@ -0,0 +1,362 @@
+#ifndef __PRECISED_FLOAT_SERIALIZATION_H__
+#define __PRECISED_FLOAT_SERIALIZATION_H__
+
+
+#include "precised_float.h"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <span>
+
+
+// Binary format of a single number, one to MAX_BYTES bytes:
+//     byte      0xFF for NaN, otherwise the sign (bit 7, set for negative numbers) and magnitude_order (bits 0-6)
+//               below 0x7F. 0x7F alone marks bigger magnitude orders, products may have them
+//     varint    only after 0x7F: magnitude_order * 2 + 1 for negative numbers, magnitude_order * 2 otherwise
+//     varint    the mantissa, 7 bits per byte from the lowest, bit 7 is set in every byte but the last, absent for NaN
+//
+// Binary format of a block of numbers:
+//     varint    count of numbers
+//     byte      scale, the magnitude order the block is coded at
+//     codes     one varint code per number: (zigzag(delta) << 2) | tag
+// The scale is at most MAGNITUDE_ORDER_LIMIT. Tags 0-2 mark a number with magnitude order scale - tag: its signed mantissa times 10^tag minus the one of the previous
+// such number (0 for the first) is the delta. Tag 3 comes with delta 0 and is followed by the number in the single number
+// format, it takes NaN, negative zeros, other magnitude orders and mantissas too big for the delta coding.
+// zigzag(delta) is 2 * delta for non-negative deltas and -2 * delta - 1 for negative ones.
+//
+// Numbers are restored exactly, magnitude orders included. Decoders refuse magnitude orders which do not fit into
+// magnitude_t and scales above MAGNITUDE_ORDER_LIMIT
+struct BinaryDecodeResult {
+    const std::byte*    ptr;
+    std::size_t         count;
+};
+
+
+namespace precised_float_details {
+    template<typename Mantissa, typename Magnitude>
+    class BinaryCodec {
+    public:
+        using p_float_t     = BasicPrecisedFloat<Mantissa, Magnitude>;
+        using mantissa_t    = Mantissa;
+        using magnitude_t   = Magnitude;
+
+
+        static constexpr std::size_t VARINT_MAX_BYTES   = (p_float_t::MANTISSA_DIGITS + 6) / 7;
+        static constexpr std::size_t ORDER_MAX_BYTES    = (std::numeric_limits<magnitude_t>::digits + 1 + 6) / 7;
+        static constexpr std::size_t MAX_BYTES          = 1 + ORDER_MAX_BYTES + VARINT_MAX_BYTES;
+        // The count, the scale and a code with the number in the single number format for every number
+        static constexpr std::size_t max_block_bytes(const std::size_t count) noexcept {
+            return (sizeof(std::size_t) * CHAR_BIT + 6) / 7 + 1 + count * (1 + MAX_BYTES);
+        }
+
+
+        // Returns the end of the number or nullptr when [<first>, <last>) is too short
+        static std::byte* encode(const p_float_t& p_float, std::byte* const first, std::byte* const last) noexcept {
+            if (last - first >= static_cast<std::ptrdiff_t>(MAX_BYTES)) {
+                return encode_unchecked(p_float, first);
+            }
+
+            std::byte buffer[MAX_BYTES];
+            const auto size = static_cast<std::size_t>(encode_unchecked(p_float, buffer) - buffer);
+            if (size > static_cast<std::size_t>(last - first)) {
+                return nullptr;
+            }
+
+            std::memcpy(first, buffer, size);
+            return first + size;
+        }
+
+        // Returns the end of the number or nullptr when it is malformed or cut off
+        static const std::byte* decode(const std::byte* first, const std::byte* const last, p_float_t& p_float) noexcept {
+            if (first == last) {
+                return nullptr;
+            }
+
+            const auto header = std::to_integer<unsigned>(*first++);
+            if (header == NAN_HEADER) {
+                p_float = p_float_t{};
+                return first;
+            }
+
+            bool is_negative = (header & SIGN_BIT) != 0;
+            unsigned long long magnitude_order = header & ORDER_MASK;
+            if (header == ORDER_ESCAPE) {
+                first = read_varint(first, last, magnitude_order);
+                if (first == nullptr || (magnitude_order >> 1) > std::numeric_limits<magnitude_t>::max()) {
+                    return nullptr;
+                }
+                is_negative = (magnitude_order & 1) != 0;
+                magnitude_order >>= 1;
+            }
+
+            mantissa_t mantissa;
+            first = read_varint(first, last, mantissa);
+            if (first == nullptr) {
+                return nullptr;
+            }
+
+            p_float = p_float_t{is_negative ? State::NEGATIVE : State::POSITIVE, static_cast<magnitude_t>(magnitude_order), mantissa};
+            return first;
+        }
+
+        // Returns the end of the block or nullptr when [<first>, <last>) is too short
+        static std::byte* encode(const std::span<const p_float_t> p_floats, std::byte* first, std::byte* const last) noexcept {
+            const auto scale = block_scale(p_floats);
+            first = write_varint(p_floats.size(), first, last);
+            if (first == nullptr || first == last) {
+                return nullptr;
+            }
+            *first++ = static_cast<std::byte>(scale);
+
+            mantissa_t previous = 0;
+            for (const auto& p_float : p_floats) {
+                // Codes and numbers are written unchecked while the longest ones fit
+                if (last - first < static_cast<std::ptrdiff_t>(1 + MAX_BYTES)) {
+                    std::byte buffer[1 + MAX_BYTES];
+                    auto previous_copy = previous;
+                    const auto size = static_cast<std::size_t>(encode_code(p_float, scale, previous_copy, buffer) - buffer);
+                    if (size > static_cast<std::size_t>(last - first)) {
+                        return nullptr;
+                    }
+                    std::memcpy(first, buffer, size);
+                    first += size;
+                    previous = previous_copy;
+                    continue;
+                }
+
+                first = encode_code(p_float, scale, previous, first);
+            }
+
+            return first;
+        }
+
+        static BinaryDecodeResult decode(const std::span<const std::byte> bytes, const std::span<p_float_t> p_floats) noexcept {
+            auto first = bytes.data();
+            const auto last = bytes.data() + bytes.size();
+
+            std::size_t count;
+            first = read_varint(first, last, count);
+            if (first == nullptr) {
+                return {nullptr, 0};
+            }
+            if (first == last || count > p_floats.size()) {
+                return {nullptr, count};
+            }
+
+            const auto scale = std::to_integer<unsigned>(*first++);
+            if (scale > p_float_t::MAGNITUDE_ORDER_LIMIT) {
+                return {nullptr, count};
+            }
+
+            mantissa_t previous = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                mantissa_t code;
+                first = read_varint(first, last, code);
+                if (first == nullptr) {
+                    return {nullptr, count};
+                }
+
+                const auto tag = static_cast<unsigned>(code & TAG_MASK);
+                if (tag == ESCAPE_TAG) {
+                    first = code == ESCAPE_TAG ? decode(first, last, p_floats[i]) : nullptr;
+                    if (first == nullptr) {
+                        return {nullptr, count};
+                    }
+                    continue;
+                }
+
+                const auto zigzag = code >> TAG_BITS;
+                previous += (zigzag >> 1) ^ (mantissa_t{0} - (zigzag & 1));
+                const bool is_negative = previous >> (p_float_t::MANTISSA_DIGITS - 1) != 0;
+                const auto scaled = is_negative ? mantissa_t{0} - previous : previous;
+                if (tag > scale || scaled > DELTA_MANTISSA_LIMITS[0]) {
+                    return {nullptr, count};
+                }
+
+                auto mantissa = scaled;
+                if (tag != 0) {
+                    mantissa = scaled / p_float_t::RADIX_POWERS[tag];
+                    if (mantissa * p_float_t::RADIX_POWERS[tag] != scaled) {
+                        return {nullptr, count};
+                    }
+                }
+                p_floats[i] = p_float_t{is_negative ? State::NEGATIVE : State::POSITIVE, static_cast<magnitude_t>(scale - tag), mantissa};
+            }
+
+            return {first, count};
+        }
+
+    private:
+        using State = typename p_float_t::State;
+
+
+        static constexpr unsigned    NAN_HEADER           = 0xFF;
+        static constexpr unsigned    SIGN_BIT             = 0x80;
+        static constexpr unsigned    ORDER_MASK           = 0x7F;
+        static constexpr unsigned    ORDER_ESCAPE         = ORDER_MASK;
+        static_assert(p_float_t::MAGNITUDE_ORDER_LIMIT < ORDER_ESCAPE, "Scales must fit into the header of a number");
+
+        static constexpr int         TAG_BITS             = 2;
+        static constexpr unsigned    TAG_MASK             = (1u << TAG_BITS) - 1;
+        static constexpr unsigned    ESCAPE_TAG           = TAG_MASK;
+        // DELTA_MANTISSA_LIMITS[tag] is the biggest mantissa which takes the delta coding with <tag>: signed mantissas
+        // times 10^tag stay within 2^(MANTISSA_DIGITS - 4), so the shifted zigzag of their difference fits into <mantissa_t>
+        static constexpr std::array<mantissa_t, ESCAPE_TAG> DELTA_MANTISSA_LIMITS = [] {
+            std::array<mantissa_t, ESCAPE_TAG> limits{};
+            for (std::size_t i = 0; i < limits.size(); ++i) {
+                limits[i] = (p_float_t::MANTISSA_MAX >> (TAG_BITS + 2)) / p_float_t::RADIX_POWERS[i];
+            }
+            return limits;
+        }();
+
+
+        static std::byte* encode_unchecked(const p_float_t& p_float, std::byte* first) noexcept {
+            if (p_float.state == State::NaN) {
+                *first = static_cast<std::byte>(NAN_HEADER);
+                return first + 1;
+            }
+
+            const bool is_negative = p_float.state == State::NEGATIVE;
+            if (p_float.magnitude_order < ORDER_ESCAPE) {
+                *first++ = static_cast<std::byte>((is_negative ? SIGN_BIT : 0) | p_float.magnitude_order);
+            } else {
+                *first++ = static_cast<std::byte>(ORDER_ESCAPE);
+                first = write_varint_unchecked(static_cast<unsigned long long>(p_float.magnitude_order) << 1 | (is_negative ? 1 : 0), first);
+            }
+            return write_varint_unchecked(p_float.mantissa, first);
+        }
+
+        // The code of <p_float> in a block at <scale>, <previous> is the last delta coded signed mantissa.
+        // Numbers of other magnitude orders are escaped
+        static std::byte* encode_code(const p_float_t& p_float, const unsigned scale, mantissa_t& previous, std::byte* first) noexcept {
+            const auto tag = scale - p_float.magnitude_order;
+            if (p_float.state == State::NaN || tag >= ESCAPE_TAG || p_float.mantissa > DELTA_MANTISSA_LIMITS[tag] ||
+                (p_float.state == State::NEGATIVE && p_float.mantissa == 0)) {
+                *first++ = static_cast<std::byte>(ESCAPE_TAG);
+                return encode_unchecked(p_float, first);
+            }
+
+            const auto scaled = p_float.mantissa * p_float_t::RADIX_POWERS[tag];
+            const auto value = p_float.state == State::NEGATIVE ? mantissa_t{0} - scaled : scaled;
+            const auto delta = value - previous;
+            const auto zigzag = (delta << 1) ^ (mantissa_t{0} - (delta >> (p_float_t::MANTISSA_DIGITS - 1)));
+            previous = value;
+
+            return write_varint_unchecked(zigzag << TAG_BITS | tag, first);
+        }
+
+        // The scale which takes the most numbers with the delta coding, the smallest of equal ones
+        static unsigned block_scale(const std::span<const p_float_t> p_floats) noexcept {
+            std::array<std::size_t, p_float_t::MAGNITUDE_ORDER_LIMIT + 1> counts{};
+            for (const auto& p_float : p_floats) {
+                if (p_float.state != State::NaN && p_float.magnitude_order <= p_float_t::MAGNITUDE_ORDER_LIMIT) {
+                    ++counts[p_float.magnitude_order];
+                }
+            }
+
+            unsigned scale = 0;
+            std::size_t best_count = 0;
+            for (unsigned order = 0; order < counts.size(); ++order) {
+                std::size_t count = 0;
+                for (unsigned tag = 0; tag < ESCAPE_TAG && tag <= order; ++tag) {
+                    count += counts[order - tag];
+                }
+                if (count > best_count) {
+                    scale = order;
+                    best_count = count;
+                }
+            }
+
+            return scale;
+        }
+
+        template<typename T>
+        static std::byte* write_varint_unchecked(T value, std::byte* first) noexcept {
+            for (; value >= 0x80; value >>= 7) {
+                *first++ = static_cast<std::byte>(static_cast<unsigned>(value & 0x7F) | 0x80);
+            }
+            *first = static_cast<std::byte>(value);
+
+            return first + 1;
+        }
+
+        template<typename T>
+        static std::byte* write_varint(const T value, std::byte* const first, std::byte* const last) noexcept {
+            std::byte buffer[(sizeof(T) * CHAR_BIT + 6) / 7];
+            const auto size = static_cast<std::size_t>(write_varint_unchecked(value, buffer) - buffer);
+            if (size > static_cast<std::size_t>(last - first)) {
+                return nullptr;
+            }
+
+            std::memcpy(first, buffer, size);
+            return first + size;
+        }
+
+        // Returns the end of the varint or nullptr when it is cut off or does not fit into <T>
+        template<typename T>
+        static const std::byte* read_varint(const std::byte* first, const std::byte* const last, T& value) noexcept {
+            constexpr int BITS = sizeof(T) * CHAR_BIT;
+
+            value = 0;
+            for (int shift = 0; first != last; shift += 7) {
+                const auto byte = std::to_integer<unsigned>(*first++);
+                const T payload = byte & 0x7F;
+                if (shift >= BITS || (payload >> (BITS - 1 - shift) >> 1) != 0) {
+                    return nullptr;
+                }
+
+                value |= payload << shift;
+                if (byte < 0x80) {
+                    return first;
+                }
+            }
+
+            return nullptr;
+        }
+    };
+} // namespace precised_float_details
+
+
+// Bytes which fit any number in the single number format, or a block of <count> numbers
+template<typename PFloat>
+constexpr std::size_t max_encoded_size() noexcept {
+    return precised_float_details::BinaryCodec<typename PFloat::mantissa_t, typename PFloat::magnitude_t>::MAX_BYTES;
+}
+
+template<typename PFloat>
+constexpr std::size_t max_encoded_size(const std::size_t count) noexcept {
+    return precised_float_details::BinaryCodec<typename PFloat::mantissa_t, typename PFloat::magnitude_t>::max_block_bytes(count);
+}
+
+// Writes <p_float> into [first, last) in the single number format, returns the end of it or nullptr when the buffer is too short
+template<typename Mantissa, typename Magnitude>
+std::byte* encode(const BasicPrecisedFloat<Mantissa, Magnitude>& p_float, std::byte* const first, std::byte* const last) noexcept {
+    return precised_float_details::BinaryCodec<Mantissa, Magnitude>::encode(p_float, first, last);
+}
+
+// Reads a number in the single number format from [first, last), returns the end of it or nullptr when it is malformed or cut off
+template<typename Mantissa, typename Magnitude>
+const std::byte* decode(const std::byte* const first, const std::byte* const last, BasicPrecisedFloat<Mantissa, Magnitude>& p_float) noexcept {
+    return precised_float_details::BinaryCodec<Mantissa, Magnitude>::decode(first, last, p_float);
+}
+
+// Writes <p_floats> into [first, last) as one block, returns the end of it or nullptr when the buffer is too short.
+// max_encoded_size<PFloat>(count) bytes are always enough. Numbers are restored exactly, magnitude orders and NaN included
+template<typename Mantissa, typename Magnitude>
+std::byte* encode(std::span<const BasicPrecisedFloat<Mantissa, Magnitude>> p_floats, std::byte* const first, std::byte* const last) noexcept {
+    return precised_float_details::BinaryCodec<Mantissa, Magnitude>::encode(p_floats, first, last);
+}
+
+// Reads the block at the start of <bytes> into the first numbers of <p_floats>. The result points past the block and holds
+// its count of numbers, the pointer is nullptr when the block is malformed or cut off or when <p_floats> is shorter than
+// the count, which is 0 when even it cannot be read
+template<typename Mantissa, typename Magnitude>
+BinaryDecodeResult decode(const std::span<const std::byte> bytes, std::span<BasicPrecisedFloat<Mantissa, Magnitude>> p_floats) noexcept {
+    return precised_float_details::BinaryCodec<Mantissa, Magnitude>::decode(bytes, p_floats);
+}
+
+#endif // __PRECISED_FLOAT_SERIALIZATION_H__